@@ -0,0 +1,430 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <iterator>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Flow
+#include <flow/captor/lockable.hpp>
+#include <flow/captor/mpsc.hpp>
+#include <flow/captor/nolock.hpp>
+#include <flow/captor/polling.hpp>
+#include <flow/captor/spsc.hpp>
+#include <flow/dispatch/shared.hpp>
+#include <flow/driver/batch.hpp>
+#include <flow/driver/next.hpp>
+#include <flow/utility/adaptive_mutex.hpp>
+
+using namespace flow;
+
+namespace
+{
+
+using DispatchType = Dispatch<std::int64_t, std::int64_t>;
+
+static constexpr std::size_t CAPTOR_CAPACITY = 10000;
+
+/// Creates a chunk of data where consecutive pairs of elements arrive swapped
+std::vector<DispatchType> make_chunk(const std::int64_t offset, const std::int64_t n)
+{
+  std::vector<DispatchType> dispatches;
+  for (std::int64_t i = 0; i < n; ++i)
+  {
+    const std::int64_t stamp = offset + (i ^ 1);
+    dispatches.emplace_back(stamp, stamp);
+  }
+  return dispatches;
+}
+
+/// Inserts chunks of data element by element
+void BM_CaptorInjectEach(benchmark::State& state)
+{
+  driver::Next<DispatchType, NoLock> captor;
+  captor.set_capacity(CAPTOR_CAPACITY);
+
+  std::int64_t offset = 0;
+  for (auto _ : state)
+  {
+    const auto dispatches = make_chunk(offset, state.range(0));
+    for (const auto& dispatch : dispatches)
+    {
+      captor.inject(dispatch);
+    }
+    offset += state.range(0);
+  }
+}
+
+/// Inserts chunks of data as a range
+void BM_CaptorInsertRange(benchmark::State& state)
+{
+  driver::Next<DispatchType, NoLock> captor;
+  captor.set_capacity(CAPTOR_CAPACITY);
+
+  std::int64_t offset = 0;
+  for (auto _ : state)
+  {
+    const auto dispatches = make_chunk(offset, state.range(0));
+    captor.insert(dispatches.begin(), dispatches.end());
+    offset += state.range(0);
+  }
+}
+
+/// Inserts chunks of data which are entirely older than the newest queued element, element by element
+void BM_CaptorInjectEachReplay(benchmark::State& state)
+{
+  driver::Next<DispatchType, NoLock> captor;
+
+  const auto newest = make_chunk(1LL << 40, 1);
+
+  std::int64_t offset = 0;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    captor.reset();
+    captor.insert(newest.begin(), newest.end());
+    const auto dispatches = make_chunk(offset, state.range(0));
+    state.ResumeTiming();
+
+    for (const auto& dispatch : dispatches)
+    {
+      captor.inject(dispatch);
+    }
+    offset += state.range(0);
+  }
+}
+
+/// Inserts chunks of data which are entirely older than the newest queued element, as a range
+void BM_CaptorInsertRangeReplay(benchmark::State& state)
+{
+  driver::Next<DispatchType, NoLock> captor;
+
+  const auto newest = make_chunk(1LL << 40, 1);
+
+  std::int64_t offset = 0;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    captor.reset();
+    captor.insert(newest.begin(), newest.end());
+    const auto dispatches = make_chunk(offset, state.range(0));
+    state.ResumeTiming();
+
+    captor.insert(dispatches.begin(), dispatches.end());
+    offset += state.range(0);
+  }
+}
+
+/// Injects late data, older than all queued data, into a captor which is at capacity
+void BM_CaptorInjectLateAtCapacity(benchmark::State& state)
+{
+  using LargeDispatchType = Dispatch<std::int64_t, std::vector<std::int64_t>>;
+
+  const std::vector<std::int64_t> payload(512UL);
+
+  driver::Next<LargeDispatchType, NoLock> captor;
+  captor.set_capacity(state.range(0));
+  for (std::int64_t stamp = 0; stamp < state.range(0); ++stamp)
+  {
+    captor.inject(stamp + state.range(0), payload);
+  }
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    captor.inject(stamp, payload);
+    stamp = (stamp + 1) % state.range(0);
+  }
+}
+
+/// Data with a large payload, which is expensive to copy
+using PayloadDispatchType = Dispatch<std::int64_t, std::vector<std::int64_t>>;
+
+static constexpr std::size_t PAYLOAD_SIZE = 4096;
+
+/// Data with a large payload, which is shared between copies
+using SharedPayloadDispatchType = SharedDispatch<std::int64_t, std::vector<std::int64_t>>;
+
+/// Captures sliding batches of large data by copy
+template <typename DispatchT> void BM_CaptorBatchCapture(benchmark::State& state)
+{
+  driver::Batch<DispatchT, NoLock> captor{static_cast<std::size_t>(state.range(0))};
+
+  const std::vector<std::int64_t> payload(PAYLOAD_SIZE);
+
+  std::int64_t stamp = 0;
+  for (; stamp < state.range(0); ++stamp)
+  {
+    captor.inject(stamp, payload);
+  }
+
+  std::vector<DispatchT> captured;
+  CaptureRange<std::int64_t> range;
+  for (auto _ : state)
+  {
+    captor.inject(stamp++, payload);
+
+    captured.clear();
+    captor.capture(std::back_inserter(captured), range);
+    for (const auto& dispatch : captured)
+    {
+      benchmark::DoNotOptimize(dispatch.value);
+    }
+  }
+}
+
+/// Captures sliding batches of large data as views of queued data
+void BM_CaptorBatchCaptureView(benchmark::State& state)
+{
+  driver::Batch<PayloadDispatchType, NoLock> captor{static_cast<std::size_t>(state.range(0))};
+
+  const std::vector<std::int64_t> payload(PAYLOAD_SIZE);
+
+  std::int64_t stamp = 0;
+  for (; stamp < state.range(0); ++stamp)
+  {
+    captor.inject(stamp, payload);
+  }
+
+  CaptureRange<std::int64_t> range;
+  for (auto _ : state)
+  {
+    captor.inject(stamp++, payload);
+
+    const auto view = std::get<1>(captor.capture_view(range));
+    for (const auto& dispatch : view)
+    {
+      benchmark::DoNotOptimize(dispatch.value.data());
+    }
+  }
+}
+
+/// Attempts capture from a polling captor
+template <typename CaptorT, typename OutputDispatchIteratorT>
+void try_capture(CaptorT& captor, OutputDispatchIteratorT output, std::true_type)
+{
+  CaptureRange<std::int64_t> range;
+  captor.capture(output, range);
+}
+
+/// Attempts capture from a waiting captor, without waiting
+template <typename CaptorT, typename OutputDispatchIteratorT>
+void try_capture(CaptorT& captor, OutputDispatchIteratorT output, std::false_type)
+{
+  CaptureRange<std::int64_t> range;
+  captor.capture(output, range, std::chrono::steady_clock::now());
+}
+
+/// Injects data one element at a time while another thread captures it
+template <typename LockPolicyT> void BM_CaptorInjectWhileCapturing(benchmark::State& state)
+{
+  using CaptorType = driver::Next<DispatchType, LockPolicyT>;
+
+  CaptorType captor;
+  captor.set_capacity(CAPTOR_CAPACITY);
+
+  std::atomic<bool> capturing{true};
+  std::thread consumer{[&captor, &capturing] {
+    std::vector<DispatchType> captured;
+    while (capturing)
+    {
+      captured.clear();
+      try_capture(captor, std::back_inserter(captured), is_polling<CaptorType>{});
+    }
+  }};
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    captor.inject(stamp, stamp);
+    ++stamp;
+
+    // Let consumer catch up, so that no data is rejected; waiting is timed, so that results reflect throughput
+    if (stamp % 256 == 0)
+    {
+      while (captor.size())
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  capturing = false;
+  consumer.join();
+
+  state.counters["rejected"] = captor.get_admission_stats().rejected;
+}
+
+/// Captor shared by all producer threads of a contended benchmark, along with its consumer thread
+template <typename LockPolicyT, typename DispatchT = DispatchType> struct ContendedCaptor
+{
+  using CaptorType = driver::Next<DispatchT, LockPolicyT>;
+
+  ContendedCaptor() :
+      consumer{[this] {
+        std::vector<DispatchT> captured;
+        while (capturing)
+        {
+          captured.clear();
+          try_capture(captor, std::back_inserter(captured), is_polling<CaptorType>{});
+        }
+      }}
+  {}
+
+  ~ContendedCaptor()
+  {
+    capturing = false;
+    consumer.join();
+  }
+
+  CaptorType captor;
+  std::atomic<bool> capturing{true};
+  std::thread consumer;
+};
+
+/// Injects data one element at a time from several producer threads while another thread captures it
+template <typename LockPolicyT> void BM_CaptorInjectContended(benchmark::State& state)
+{
+  static std::unique_ptr<ContendedCaptor<LockPolicyT>> shared;
+  if (state.thread_index() == 0)
+  {
+    shared.reset(new ContendedCaptor<LockPolicyT>{});
+  }
+
+  // All threads wait here, on loop entry, until setup is complete
+  std::int64_t stamp = state.thread_index();
+  std::size_t injected = 0;
+  for (auto _ : state)
+  {
+    shared->captor.inject(stamp, stamp);
+    stamp += state.threads();
+
+    // Let consumer catch up, so that as little data as possible is rejected
+    if (++injected % 64 == 0)
+    {
+      while (shared->captor.size() > 256UL)
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  // All threads wait on loop exit, so no other thread is still injecting
+  if (state.thread_index() == 0)
+  {
+    const auto admission_stats = shared->captor.get_admission_stats();
+    state.counters["rejected"] = admission_stats.rejected;
+    shared.reset();
+  }
+}
+
+/// Injects copies of data with a large payload from several producer threads while another thread captures it
+template <typename LockPolicyT> void BM_CaptorInjectPayloadContended(benchmark::State& state)
+{
+  static std::unique_ptr<ContendedCaptor<LockPolicyT, PayloadDispatchType>> shared;
+  if (state.thread_index() == 0)
+  {
+    shared.reset(new ContendedCaptor<LockPolicyT, PayloadDispatchType>{});
+  }
+
+  const std::vector<std::int64_t> payload(PAYLOAD_SIZE);
+
+  // All threads wait here, on loop entry, until setup is complete
+  std::int64_t stamp = state.thread_index();
+  std::size_t injected = 0;
+  for (auto _ : state)
+  {
+    shared->captor.inject(stamp, payload);
+    stamp += state.threads();
+
+    // Let consumer catch up, so that as little data as possible is rejected
+    if (++injected % 64 == 0)
+    {
+      while (shared->captor.size() > 256UL)
+      {
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  // All threads wait on loop exit, so no other thread is still injecting
+  if (state.thread_index() == 0)
+  {
+    shared.reset();
+  }
+}
+
+/// Inspects a full captor from several reader threads at once
+template <typename LockPolicyT> void BM_CaptorInspectContended(benchmark::State& state)
+{
+  static std::unique_ptr<driver::Next<DispatchType, LockPolicyT>> shared;
+  if (state.thread_index() == 0)
+  {
+    shared.reset(new driver::Next<DispatchType, LockPolicyT>{});
+    for (std::int64_t stamp = 0; stamp < 256; ++stamp)
+    {
+      shared->inject(stamp, stamp);
+    }
+  }
+
+  // All threads wait here, on loop entry, until setup is complete
+  for (auto _ : state)
+  {
+    std::int64_t sum = 0;
+    shared->inspect([&sum](const DispatchType& dispatch) { sum += dispatch.value; });
+    benchmark::DoNotOptimize(sum);
+  }
+
+  // All threads wait on loop exit, so no other thread is still inspecting
+  if (state.thread_index() == 0)
+  {
+    shared.reset();
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_CaptorInjectEach)->Arg(100)->Arg(1000);
+BENCHMARK(BM_CaptorInsertRange)->Arg(100)->Arg(1000);
+BENCHMARK(BM_CaptorInjectEachReplay)->Arg(1000);
+BENCHMARK(BM_CaptorInsertRangeReplay)->Arg(1000);
+BENCHMARK(BM_CaptorInjectLateAtCapacity)->Arg(1000);
+BENCHMARK_TEMPLATE(BM_CaptorBatchCapture, PayloadDispatchType)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(BM_CaptorBatchCapture, SharedPayloadDispatchType)->Arg(16)->Arg(64);
+BENCHMARK(BM_CaptorBatchCaptureView)->Arg(16)->Arg(64);
+BENCHMARK_TEMPLATE(BM_CaptorInjectWhileCapturing, std::unique_lock<std::mutex>);
+BENCHMARK_TEMPLATE(BM_CaptorInjectWhileCapturing, SPSCLane<1024>);
+BENCHMARK_TEMPLATE(BM_CaptorInjectContended, std::unique_lock<std::mutex>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CaptorInjectContended, std::unique_lock<AdaptiveMutex>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CaptorInjectContended, PollingLock<std::lock_guard<std::mutex>>)
+  ->ThreadRange(1, 16)
+  ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CaptorInjectContended, PollingLock<std::lock_guard<AdaptiveMutex>>)
+  ->ThreadRange(1, 16)
+  ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CaptorInjectContended, MPSCLane<1024>)->ThreadRange(1, 16)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CaptorInspectContended, std::unique_lock<std::mutex>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CaptorInspectContended, std::unique_lock<std::shared_timed_mutex>)
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CaptorInjectPayloadContended, std::unique_lock<std::mutex>)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_CaptorInjectPayloadContended, PollingLock<std::lock_guard<std::mutex>>)
+  ->ThreadRange(1, 8)
+  ->UseRealTime();
+
+#endif  // DOXYGEN_SKIP
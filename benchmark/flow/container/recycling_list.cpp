@@ -0,0 +1,82 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <iterator>
+#include <list>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Flow
+#include <flow/captor/nolock.hpp>
+#include <flow/container/recycling_list.hpp>
+#include <flow/container/splice_inserter.hpp>
+#include <flow/follower/any_before.hpp>
+
+using namespace flow;
+
+namespace
+{
+
+/// Data with a large, in-place payload, which is as expensive to move as it is to copy
+using PayloadDispatchType = Dispatch<std::int64_t, std::array<std::int64_t, 64>>;
+
+/// Captures all queued data by moving it into a vector
+void BM_AnyBeforeCaptureMove(benchmark::State& state)
+{
+  follower::AnyBefore<PayloadDispatchType, NoLock, std::deque<PayloadDispatchType>> captor{0};
+
+  const std::array<std::int64_t, 64> payload{};
+  std::vector<PayloadDispatchType> data;
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    for (std::int64_t n = 0; n < state.range(0); ++n, ++stamp)
+    {
+      captor.inject(stamp, payload);
+    }
+
+    data.clear();
+    CaptureRange<std::int64_t> range{stamp, stamp};
+    benchmark::DoNotOptimize(captor.capture(std::back_inserter(data), range));
+  }
+}
+
+/// Captures all queued data by splicing it into a list
+template <typename ListT> void BM_AnyBeforeCaptureSplice(benchmark::State& state)
+{
+  follower::AnyBefore<PayloadDispatchType, NoLock, ListT> captor{0};
+
+  const std::array<std::int64_t, 64> payload{};
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    for (std::int64_t n = 0; n < state.range(0); ++n, ++stamp)
+    {
+      captor.inject(stamp, payload);
+    }
+
+    // Spliced nodes are recycled by the receiving list, so it is dropped after each capture to bound memory use
+    ListT data;
+    CaptureRange<std::int64_t> range{stamp, stamp};
+    benchmark::DoNotOptimize(captor.capture(splice_inserter(data), range));
+  }
+}
+
+}  // namespace
+
+BENCHMARK(BM_AnyBeforeCaptureMove)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_AnyBeforeCaptureSplice, std::list<PayloadDispatchType>)->Arg(16)->Arg(256);
+BENCHMARK_TEMPLATE(BM_AnyBeforeCaptureSplice, RecyclingList<PayloadDispatchType>)->Arg(16)->Arg(256);
+
+#endif  // DOXYGEN_SKIP
@@ -0,0 +1,117 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <utility>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Flow
+#include <flow/container/recycling_list.hpp>
+#include <flow/container/ring_buffer.hpp>
+#include <flow/dispatch_queue.hpp>
+
+using namespace flow;
+
+namespace
+{
+
+using DispatchType = Dispatch<std::int64_t, std::int64_t>;
+
+static constexpr std::size_t QUEUE_CAPACITY = 1000;
+
+template <typename ContainerT> using Queue = DispatchQueue<DispatchType, ContainerT>;
+
+/// Adapts <code>std::vector</code> to meet DispatchQueue container requirements
+template <typename T> struct Vector : std::vector<T>
+{
+  template <typename... ArgTs> void emplace_front(ArgTs&&... args)
+  {
+    this->emplace(this->begin(), std::forward<ArgTs>(args)...);
+  }
+
+  void pop_front() { this->erase(this->begin()); }
+};
+
+/// Inserts in-order data, limiting queue size the same way captors do
+template <typename ContainerT> void BM_DispatchQueueInsertAndLimit(benchmark::State& state)
+{
+  Queue<ContainerT> queue;
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    queue.insert(stamp, stamp);
+    queue.shrink_to_fit(QUEUE_CAPACITY);
+    ++stamp;
+  }
+  benchmark::DoNotOptimize(queue.size());
+}
+
+/// Inserts data where every other element arrives one step late
+template <typename ContainerT> void BM_DispatchQueueInsertOutOfOrderAndLimit(benchmark::State& state)
+{
+  Queue<ContainerT> queue;
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    queue.insert(stamp + 1, stamp);
+    queue.insert(stamp, stamp);
+    queue.shrink_to_fit(QUEUE_CAPACITY);
+    stamp += 2;
+  }
+  benchmark::DoNotOptimize(queue.size());
+}
+
+/// Inserts and removes data in chunks, as with <code>driver::Chunk</code>
+template <typename ContainerT> void BM_DispatchQueueInsertRemoveFirstN(benchmark::State& state)
+{
+  Queue<ContainerT> queue;
+
+  const auto chunk_size = static_cast<std::size_t>(state.range(0));
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    for (std::size_t n = 0; n < chunk_size; ++n, ++stamp)
+    {
+      queue.insert(stamp, stamp);
+    }
+    queue.remove_first_n(chunk_size);
+  }
+  benchmark::DoNotOptimize(queue.size());
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertAndLimit, std::deque<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertAndLimit, Vector<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertAndLimit, std::list<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertAndLimit, RecyclingList<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertAndLimit, RingBuffer<DispatchType, QUEUE_CAPACITY + 1>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertAndLimit, RingBuffer<DispatchType>);
+
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertOutOfOrderAndLimit, std::deque<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertOutOfOrderAndLimit, Vector<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertOutOfOrderAndLimit, std::list<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertOutOfOrderAndLimit, RecyclingList<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertOutOfOrderAndLimit, RingBuffer<DispatchType, QUEUE_CAPACITY + 2>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertOutOfOrderAndLimit, RingBuffer<DispatchType>);
+
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertRemoveFirstN, std::deque<DispatchType>)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertRemoveFirstN, Vector<DispatchType>)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertRemoveFirstN, std::list<DispatchType>)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertRemoveFirstN, RecyclingList<DispatchType>)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertRemoveFirstN, RingBuffer<DispatchType, 100>)->Arg(10)->Arg(100);
+BENCHMARK_TEMPLATE(BM_DispatchQueueInsertRemoveFirstN, RingBuffer<DispatchType>)->Arg(10)->Arg(100);
+
+#endif  // DOXYGEN_SKIP
@@ -0,0 +1,70 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <array>
+#include <cstdint>
+#include <deque>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Flow
+#include <flow/container/stamp_indexed.hpp>
+#include <flow/dispatch_queue.hpp>
+
+using namespace flow;
+
+namespace
+{
+
+/// Dispatch with a large payload, such that each element spans many cache lines
+using PayloadType = std::array<char, 4096>;
+
+using DispatchType = Dispatch<std::int64_t, PayloadType>;
+
+static constexpr std::int64_t QUEUE_SIZE = 1000;
+
+/// Searches for a range of stamps, as followers do on each locate
+template <typename ContainerT> void BM_DispatchQueueSearchLargePayload(benchmark::State& state)
+{
+  DispatchQueue<DispatchType, ContainerT> queue;
+  for (std::int64_t stamp = 0; stamp < QUEUE_SIZE; ++stamp)
+  {
+    queue.insert(stamp, PayloadType{});
+  }
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(queue.lower_bound(stamp));
+    stamp = (stamp + 97) % QUEUE_SIZE;
+  }
+}
+
+/// Removes old data, as captors do on each capture
+template <typename ContainerT> void BM_DispatchQueueRemoveBeforeLargePayload(benchmark::State& state)
+{
+  DispatchQueue<DispatchType, ContainerT> queue;
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    queue.insert(stamp, PayloadType{});
+    queue.remove_before(stamp - QUEUE_SIZE);
+    ++stamp;
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_DispatchQueueSearchLargePayload, std::deque<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueSearchLargePayload, StampIndexed<std::deque<DispatchType>>);
+
+BENCHMARK_TEMPLATE(BM_DispatchQueueRemoveBeforeLargePayload, std::deque<DispatchType>);
+BENCHMARK_TEMPLATE(BM_DispatchQueueRemoveBeforeLargePayload, StampIndexed<std::deque<DispatchType>>);
+
+#endif  // DOXYGEN_SKIP
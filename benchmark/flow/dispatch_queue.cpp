@@ -0,0 +1,157 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <cstdint>
+#include <deque>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Flow
+#include <flow/container/ring_buffer.hpp>
+#include <flow/dispatch_queue.hpp>
+
+using namespace flow;
+
+namespace
+{
+
+using DispatchType = Dispatch<std::int64_t, std::int64_t>;
+
+using Queue = DispatchQueue<DispatchType, std::deque<DispatchType>>;
+
+/// Fills queue with <code>n</code> in-order elements
+Queue make_queue(const std::int64_t n)
+{
+  Queue queue;
+  for (std::int64_t stamp = 0; stamp < n; ++stamp)
+  {
+    queue.insert(stamp, stamp);
+  }
+  return queue;
+}
+
+/// Searches for stamps near the newest element, as followers do when histories are long
+void BM_DispatchQueueLowerBound(benchmark::State& state)
+{
+  const auto queue = make_queue(state.range(0));
+
+  const std::int64_t stamp = state.range(0) - 1;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(queue.lower_bound(stamp));
+  }
+}
+
+/// Searches for stamps near the newest element, as followers do when histories are long
+void BM_DispatchQueueUpperBound(benchmark::State& state)
+{
+  const auto queue = make_queue(state.range(0));
+
+  const std::int64_t stamp = state.range(0) - 1;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(queue.upper_bound(stamp));
+  }
+}
+
+/// Searches for a boundary which advances by one element per frame, within a history which is kept at a fixed size
+template <typename ContainerT, bool UseCursor> void BM_DispatchQueueAdvancingLowerBound(benchmark::State& state)
+{
+  DispatchQueue<DispatchType, ContainerT> queue;
+  for (std::int64_t stamp = 0; stamp < state.range(0); ++stamp)
+  {
+    queue.insert(stamp, stamp);
+  }
+
+  SearchCursor<std::int64_t> cursor;
+  std::int64_t boundary = state.range(0) / 2;
+  for (auto _ : state)
+  {
+    queue.insert(boundary + state.range(0) / 2, boundary);
+    queue.pop();
+    benchmark::DoNotOptimize(UseCursor ? queue.lower_bound(cursor, boundary) : queue.lower_bound(boundary));
+    ++boundary;
+  }
+}
+
+/// Drops a large backlog of stale elements, as on abort after a driver stall
+template <typename QueueT> void remove_backlog(benchmark::State& state)
+{
+  const std::int64_t backlog = state.range(0);
+
+  QueueT queue;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    queue.clear();
+    for (std::int64_t stamp = 0; stamp <= backlog; ++stamp)
+    {
+      queue.insert(stamp, stamp);
+    }
+    state.ResumeTiming();
+
+    queue.remove_before(backlog);
+  }
+  state.SetItemsProcessed(state.iterations() * backlog);
+}
+
+void BM_DispatchQueueRemoveBefore(benchmark::State& state) { remove_backlog<Queue>(state); }
+
+void BM_DispatchQueueRemoveBeforeRingBuffer(benchmark::State& state)
+{
+  remove_backlog<DispatchQueue<DispatchType, RingBuffer<DispatchType>>>(state);
+}
+
+/// Inserts a burst of elements in reverse stamp order, as with drivers which deliver late bursts
+template <typename QueueT> void insert_reversed_burst(benchmark::State& state)
+{
+  const std::int64_t burst = state.range(0);
+
+  std::int64_t offset = 0;
+  QueueT queue;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    queue.clear();
+    queue.insert(offset + burst, offset + burst);
+    state.ResumeTiming();
+
+    for (std::int64_t stamp = offset + burst - 1; stamp >= offset; --stamp)
+    {
+      queue.insert(stamp, stamp);
+    }
+    offset += burst + 1;
+  }
+  state.SetItemsProcessed(state.iterations() * burst);
+}
+
+void BM_DispatchQueueInsertReversedBurst(benchmark::State& state) { insert_reversed_burst<Queue>(state); }
+
+void BM_DispatchQueueInsertReversedBurstIndexed(benchmark::State& state)
+{
+  insert_reversed_burst<DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>>>(state);
+}
+
+}  // namespace
+
+BENCHMARK(BM_DispatchQueueLowerBound)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK(BM_DispatchQueueUpperBound)->Arg(100)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_DispatchQueueAdvancingLowerBound, std::deque<DispatchType>, false)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_DispatchQueueAdvancingLowerBound, std::deque<DispatchType>, true)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_DispatchQueueAdvancingLowerBound, StampIndexed<std::deque<DispatchType>>, false)
+  ->Arg(1000)
+  ->Arg(100000);
+BENCHMARK_TEMPLATE(BM_DispatchQueueAdvancingLowerBound, StampIndexed<std::deque<DispatchType>>, true)
+  ->Arg(1000)
+  ->Arg(100000);
+BENCHMARK(BM_DispatchQueueRemoveBefore)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_DispatchQueueRemoveBeforeRingBuffer)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK(BM_DispatchQueueInsertReversedBurst)->Arg(10)->Arg(100)->Arg(1000);
+BENCHMARK(BM_DispatchQueueInsertReversedBurstIndexed)->Arg(10)->Arg(100)->Arg(1000);
+
+#endif  // DOXYGEN_SKIP
@@ -0,0 +1,374 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Flow
+#include <flow/captor/lockable.hpp>
+#include <flow/drivers.hpp>
+#include <flow/event_synchronizer.hpp>
+#include <flow/followers.hpp>
+#include <flow/synchronizer.hpp>
+#include <flow/synchronizer_group.hpp>
+
+using namespace flow;
+
+namespace
+{
+
+using DispatchType = Dispatch<std::int64_t, std::int64_t>;
+
+using LockType = std::unique_lock<std::mutex>;
+
+/// Blocking captors for a three-stream frame
+struct Captors
+{
+  driver::Next<DispatchType, LockType> driver;
+  follower::Before<DispatchType, LockType> first{0};
+  follower::Before<DispatchType, LockType> second{0};
+};
+
+/// Feeds all captors one frame at a time from another thread, staying a few frames ahead of capture
+class Producer
+{
+public:
+  explicit Producer(Captors& captors) :
+      thread_{[this, &captors] {
+        std::int64_t stamp = 0;
+        while (producing_)
+        {
+          if (captors.driver.size() > 4UL)
+          {
+            std::this_thread::yield();
+            continue;
+          }
+          captors.first.inject(stamp, stamp);
+          captors.second.inject(stamp, stamp);
+          captors.driver.inject(stamp, stamp);
+          ++stamp;
+        }
+      }}
+  {}
+
+  ~Producer()
+  {
+    producing_ = false;
+    thread_.join();
+  }
+
+private:
+  std::atomic<bool> producing_{true};
+  std::thread thread_;
+};
+
+/// Number of allocations made through CountingAllocator
+std::size_t allocation_count = 0UL;
+
+/// Allocator which counts allocations
+template <typename T> struct CountingAllocator
+{
+  using value_type = T;
+
+  CountingAllocator() = default;
+
+  template <typename U> CountingAllocator(const CountingAllocator<U>&) {}
+
+  T* allocate(const std::size_t n)
+  {
+    ++allocation_count;
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* const ptr, const std::size_t n) { std::allocator<T>{}.deallocate(ptr, n); }
+
+  template <typename U> bool operator==(const CountingAllocator<U>&) const { return true; }
+  template <typename U> bool operator!=(const CountingAllocator<U>&) const { return false; }
+};
+
+/// Output buffer type which counts its allocations
+using OutputBufferType = std::vector<DispatchType, CountingAllocator<DispatchType>>;
+
+/// Captors for frames in which a follower captures many elements
+struct LargeFrameCaptors
+{
+  driver::Next<DispatchType, LockType> driver;
+  follower::AnyBefore<DispatchType, LockType> follower{0};
+
+  /// Injects a frame in which the follower captures \p frame_size elements
+  void inject(const std::int64_t frame, const std::int64_t frame_size)
+  {
+    for (std::int64_t n = 0; n < frame_size; ++n)
+    {
+      follower.inject(frame * frame_size + n, n);
+    }
+    driver.inject((frame + 1) * frame_size, frame);
+  }
+};
+
+/// Captures a frame into fresh output buffers which grow as data is captured
+void BM_SynchronizerCaptureGrowingOutput(benchmark::State& state)
+{
+  LargeFrameCaptors captors;
+
+  allocation_count = 0UL;
+  std::int64_t frame = 0;
+  for (auto _ : state)
+  {
+    captors.inject(frame++, state.range(0));
+
+    OutputBufferType driver_data;
+    OutputBufferType follower_data;
+    const auto result = Synchronizer::capture_locked(
+      std::forward_as_tuple(captors.driver, captors.follower),
+      std::forward_as_tuple(std::back_inserter(driver_data), std::back_inserter(follower_data)));
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["allocations_per_frame"] =
+    benchmark::Counter(static_cast<double>(allocation_count), benchmark::Counter::kAvgIterations);
+}
+
+/// Captures a frame into fresh output buffers which are sized from locate before data is captured
+void BM_SynchronizerCapturePresizedOutput(benchmark::State& state)
+{
+  LargeFrameCaptors captors;
+
+  allocation_count = 0UL;
+  std::int64_t frame = 0;
+  for (auto _ : state)
+  {
+    captors.inject(frame++, state.range(0));
+
+    const auto located = Synchronizer::locate(std::forward_as_tuple(captors.driver, captors.follower));
+
+    OutputBufferType driver_data;
+    OutputBufferType follower_data;
+    driver_data.reserve(located.sizes[0]);
+    follower_data.reserve(located.sizes[1]);
+    const auto result = Synchronizer::capture_locked(
+      std::forward_as_tuple(captors.driver, captors.follower),
+      std::forward_as_tuple(std::back_inserter(driver_data), std::back_inserter(follower_data)),
+      located);
+    benchmark::DoNotOptimize(result);
+  }
+  state.counters["allocations_per_frame"] =
+    benchmark::Counter(static_cast<double>(allocation_count), benchmark::Counter::kAvgIterations);
+}
+
+/// Captures frames with a separate wait on each blocking captor
+void BM_SynchronizerCaptureBlocking(benchmark::State& state)
+{
+  Captors captors;
+  Producer producer{captors};
+
+  for (auto _ : state)
+  {
+    const auto result = Synchronizer::capture(
+      std::forward_as_tuple(captors.driver, captors.first, captors.second),
+      std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}));
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+/// Captures frames with a single wait on a notifier shared by all captors
+void BM_SynchronizerGroupCaptureBlocking(benchmark::State& state)
+{
+  Captors captors;
+  SynchronizerGroup<decltype(captors.driver), decltype(captors.first), decltype(captors.second)> group{
+    captors.driver, captors.first, captors.second};
+  Producer producer{captors};
+
+  for (auto _ : state)
+  {
+    const auto result = group.capture(std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}));
+    benchmark::DoNotOptimize(result);
+  }
+}
+
+/// Injects a single frame and captures it, locking each captor separately for locate, extract and monitor update
+void BM_SynchronizerCaptureFrame(benchmark::State& state)
+{
+  Captors captors;
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    captors.first.inject(stamp, stamp);
+    captors.second.inject(stamp, stamp);
+    captors.driver.inject(stamp, stamp);
+    const auto result = Synchronizer::capture(
+      std::forward_as_tuple(captors.driver, captors.first, captors.second),
+      std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}));
+    benchmark::DoNotOptimize(result);
+    ++stamp;
+  }
+}
+
+/// Injects a single frame and captures it, locking each captor once for the whole capture
+void BM_SynchronizerCaptureLockedFrame(benchmark::State& state)
+{
+  Captors captors;
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    captors.first.inject(stamp, stamp);
+    captors.second.inject(stamp, stamp);
+    captors.driver.inject(stamp, stamp);
+    const auto result = Synchronizer::capture_locked(
+      std::forward_as_tuple(captors.driver, captors.first, captors.second),
+      std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}));
+    benchmark::DoNotOptimize(result);
+    ++stamp;
+  }
+}
+
+/// Injects a single frame, which is captured from inject; follower injections do not re-check readiness
+void BM_EventSynchronizerInjectFrame(benchmark::State& state)
+{
+  Captors captors;
+
+  using EventSynchronizerType =
+    EventSynchronizer<decltype(captors.driver), decltype(captors.first), decltype(captors.second)>;
+
+  std::size_t frame_count = 0UL;
+  EventSynchronizerType sync{
+    [&frame_count](const EventSynchronizerType::result_type&, EventSynchronizerType::frame_type&&) { ++frame_count; },
+    captors.driver,
+    captors.first,
+    captors.second};
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    captors.first.inject(stamp, stamp);
+    captors.second.inject(stamp, stamp);
+    captors.driver.inject(stamp, stamp);
+    ++stamp;
+  }
+  state.counters["frames"] = benchmark::Counter(static_cast<double>(frame_count), benchmark::Counter::kAvgIterations);
+}
+
+/// Injects a single frame, polls readiness with locate, then captures with capture_locked, locating a second time
+void BM_SynchronizerLocateThenCapture(benchmark::State& state)
+{
+  Captors captors;
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    captors.first.inject(stamp, stamp);
+    captors.second.inject(stamp, stamp);
+    captors.driver.inject(stamp, stamp);
+    if (Synchronizer::locate(std::forward_as_tuple(captors.driver, captors.first, captors.second)))
+    {
+      const auto result = Synchronizer::capture_locked(
+        std::forward_as_tuple(captors.driver, captors.first, captors.second),
+        std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}));
+      benchmark::DoNotOptimize(result);
+    }
+    ++stamp;
+  }
+}
+
+/// Injects a single frame, polls readiness with locate, then captures the located frame without locating again
+void BM_SynchronizerLocateThenCaptureLocated(benchmark::State& state)
+{
+  Captors captors;
+
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    captors.first.inject(stamp, stamp);
+    captors.second.inject(stamp, stamp);
+    captors.driver.inject(stamp, stamp);
+    const auto located = Synchronizer::locate(std::forward_as_tuple(captors.driver, captors.first, captors.second));
+    if (located)
+    {
+      const auto result = Synchronizer::capture_locked(
+        std::forward_as_tuple(captors.driver, captors.first, captors.second),
+        std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}),
+        located);
+      benchmark::DoNotOptimize(result);
+    }
+    ++stamp;
+  }
+}
+
+/// Injects a backlog of frames, then drains it by calling capture_locked once per frame
+void BM_SynchronizerCaptureLockedBacklog(benchmark::State& state)
+{
+  Captors captors;
+
+  const std::int64_t backlog = state.range(0);
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    for (std::int64_t n = 0; n < backlog; ++n, ++stamp)
+    {
+      captors.first.inject(stamp, stamp);
+      captors.second.inject(stamp, stamp);
+      captors.driver.inject(stamp, stamp);
+    }
+    while (std::get<0>(Synchronizer::capture_locked(
+      std::forward_as_tuple(captors.driver, captors.first, captors.second),
+      std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}))))
+    {}
+  }
+  state.SetItemsProcessed(state.iterations() * backlog);
+}
+
+/// Injects a backlog of frames, then drains it with a single capture_all call
+void BM_SynchronizerCaptureAllBacklog(benchmark::State& state)
+{
+  Captors captors;
+
+  const std::int64_t backlog = state.range(0);
+  std::int64_t stamp = 0;
+  for (auto _ : state)
+  {
+    for (std::int64_t n = 0; n < backlog; ++n, ++stamp)
+    {
+      captors.first.inject(stamp, stamp);
+      captors.second.inject(stamp, stamp);
+      captors.driver.inject(stamp, stamp);
+    }
+    const auto result = Synchronizer::capture_all(
+      std::forward_as_tuple(captors.driver, captors.first, captors.second),
+      std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}),
+      [](const Result<std::int64_t>& frame) { benchmark::DoNotOptimize(frame); });
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * backlog);
+}
+
+}  // namespace
+
+BENCHMARK(BM_SynchronizerCaptureFrame);
+BENCHMARK(BM_SynchronizerCaptureLockedFrame);
+BENCHMARK(BM_EventSynchronizerInjectFrame);
+BENCHMARK(BM_SynchronizerLocateThenCapture);
+BENCHMARK(BM_SynchronizerLocateThenCaptureLocated);
+BENCHMARK(BM_SynchronizerCaptureGrowingOutput)->Arg(16)->Arg(256);
+BENCHMARK(BM_SynchronizerCapturePresizedOutput)->Arg(16)->Arg(256);
+BENCHMARK(BM_SynchronizerCaptureLockedBacklog)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK(BM_SynchronizerCaptureAllBacklog)->Arg(1)->Arg(8)->Arg(64);
+BENCHMARK(BM_SynchronizerCaptureBlocking)->UseRealTime();
+BENCHMARK(BM_SynchronizerGroupCaptureBlocking)->UseRealTime();
+
+#endif  // DOXYGEN_SKIP
@@ -0,0 +1,102 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+// Benchmark
+#include <benchmark/benchmark.h>
+
+// Flow
+#include <flow/utility/stamp_search.hpp>
+
+using namespace flow;
+
+namespace
+{
+
+/// Creates sorted keys, with queries spread across the full range
+template <typename KeyT> std::vector<KeyT> make_keys(const std::size_t n)
+{
+  std::vector<KeyT> keys(n);
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    keys[i] = static_cast<KeyT>(i);
+  }
+  return keys;
+}
+
+/// Baseline binary search
+template <typename KeyT> void BM_StdLowerBound(benchmark::State& state)
+{
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto keys = make_keys<KeyT>(n);
+
+  std::size_t query = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(std::lower_bound(keys.begin(), keys.end(), static_cast<KeyT>(query)));
+    query = (query + 7919UL) % n;
+  }
+}
+
+/// Binary search, finishing with a (SIMD) linear count over a small window
+template <typename KeyT> void BM_StampLowerBound(benchmark::State& state)
+{
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto keys = make_keys<KeyT>(n);
+
+  std::size_t query = 0;
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(stamp_lower_bound(keys.data(), n, static_cast<KeyT>(query)));
+    query = (query + 7919UL) % n;
+  }
+}
+
+/// Baseline linear scan, as used by followers prior to stamp indexing
+template <typename KeyT> void BM_StdFindIf(benchmark::State& state)
+{
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto keys = make_keys<KeyT>(n);
+
+  const auto query = static_cast<KeyT>(n - 1);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(
+      std::find_if(keys.begin(), keys.end(), [query](const KeyT key) { return key >= query; }));
+  }
+}
+
+/// Full (SIMD) linear count
+template <typename KeyT> void BM_CountLess(benchmark::State& state)
+{
+  const auto n = static_cast<std::size_t>(state.range(0));
+  const auto keys = make_keys<KeyT>(n);
+
+  const auto query = static_cast<KeyT>(n - 1);
+  for (auto _ : state)
+  {
+    benchmark::DoNotOptimize(detail::count_less(keys.data(), n, query));
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(BM_StdLowerBound, std::int64_t)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_StampLowerBound, std::int64_t)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_StampLowerBound, std::uint64_t)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_StdLowerBound, std::int32_t)->Arg(1000)->Arg(10000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_StampLowerBound, std::int32_t)->Arg(1000)->Arg(10000)->Arg(100000);
+
+BENCHMARK_TEMPLATE(BM_StdFindIf, std::int64_t)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_CountLess, std::int64_t)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_StdFindIf, std::int32_t)->Arg(1000)->Arg(10000);
+BENCHMARK_TEMPLATE(BM_CountLess, std::int32_t)->Arg(1000)->Arg(10000);
+
+#endif  // DOXYGEN_SKIP
@@ -9,15 +9,19 @@
 #include <chrono>
 #include <cstdint>
 #include <deque>
+#include <iterator>
 #include <tuple>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 // Flow
 #include <flow/captor_state.hpp>
 #include <flow/dispatch.hpp>
 #include <flow/dispatch_queue.hpp>
+#include <flow/group_notifier.hpp>
 #include <flow/utility/implement_crtp_base.hpp>
+#include <flow/utility/seqlock.hpp>
 #include <flow/utility/static_assert.hpp>
 
 namespace flow
@@ -38,6 +42,80 @@ struct NoLock
 {};
 
 
+/**
+ * @brief Captor behavior when new data arrives while its queue is at capacity
+ */
+enum class AdmissionPolicy : int
+{
+  DROP_OLDEST,  ///< Oldest elements are dropped to make room for new data (default)
+  REJECT_INCOMING,  ///< New data is rejected while the queue is at capacity
+  REJECT_IF_OLDER_THAN_FRONT,  ///< New data older than the oldest queued element is always rejected; otherwise, oldest
+                               ///< elements are dropped to make room for new data
+};
+
+
+/**
+ * @brief Counters describing data discarded by a Captor to respect its capacity and admission policy
+ */
+struct AdmissionStats
+{
+  /// Number of elements dropped as the oldest element of a queue at capacity
+  std::size_t dropped = 0UL;
+
+  /// Number of elements rejected by the admission policy before being queued
+  std::size_t rejected = 0UL;
+};
+
+
+/**
+ * @brief Queue state which must be reached before a waiting capture could change state
+ *
+ * Published by capture policies so that blocking captors only wake waiting threads on insertions which could
+ * actually change capture state. A default-constructed threshold is always met.
+ *
+ * @tparam StampT  sequencing stamp type
+ */
+template <typename StampT> struct WakeThreshold
+{
+  /// Minimum number of queued elements
+  std::size_t min_size = 0UL;
+
+  /// Minimum stamp of newest queued element; not checked when equal to <code>StampTraits<StampT>::min()</code>
+  StampT min_newest_stamp = StampTraits<StampT>::min();
+
+  /**
+   * @brief Checks if \p queue has reached this threshold
+   */
+  template <typename DispatchQueueT> inline bool is_met(const DispatchQueueT& queue) const
+  {
+    if (queue.size() < min_size)
+    {
+      return false;
+    }
+    else if (!(StampTraits<StampT>::min() < min_newest_stamp))
+    {
+      return true;
+    }
+    return !queue.empty() and !(queue.newest_stamp() < min_newest_stamp);
+  }
+};
+
+
+/**
+ * @brief Queue size and stamp range, published by multi-threaded captors so that they can be read without locking
+ *
+ * @tparam StampT  sequencing stamp type
+ */
+template <typename StampT> struct QueueMetadata
+{
+  /// Number of queued elements
+  std::size_t size = 0UL;
+
+  /// Stamps of oldest and newest queued elements; invalid when queue is empty
+  CaptureRange<StampT> range;
+};
+
+
 /**
  * @brief Stand-in type used to replace queue monitor
  */
@@ -82,6 +160,84 @@ struct DefaultDispatchQueueMonitor
 };
 
 
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/**
+ * @brief Checks if constructor arguments consist of a single, existing <code>DispatchT</code>
+ */
+template <typename DispatchT, typename... InsertArgTs> struct IsDispatchArg : std::false_type
+{};
+
+template <typename DispatchT, typename InsertArgT>
+struct IsDispatchArg<DispatchT, InsertArgT> : std::is_same<std::decay_t<InsertArgT>, DispatchT>
+{};
+
+/**
+ * @brief Checks if constructor arguments lead with the sequence stamp of a new <code>DispatchT</code>
+ *
+ * True for <code>Dispatch</code> constructor arguments when stamps are accessed with <code>DefaultStampAccess</code>
+ */
+template <typename DispatchT, typename AccessStampT, typename... InsertArgTs> struct IsStampFirstArgs : std::false_type
+{};
+
+template <typename StampT, typename ValueT, typename StampArgT, typename... ValueArgTs>
+struct IsStampFirstArgs<Dispatch<StampT, ValueT>, DefaultStampAccess, StampArgT, ValueArgTs...>
+    : std::is_convertible<StampArgT, StampT>
+{};
+
+/**
+ * @brief Checks if the stamp of a new <code>DispatchT</code> can be read from its constructor arguments
+ */
+template <typename DispatchT, typename AccessStampT, typename... InsertArgTs>
+struct CanPeekStamp
+    : std::integral_constant<
+        bool,
+        IsDispatchArg<DispatchT, InsertArgTs...>::value or
+          IsStampFirstArgs<DispatchT, AccessStampT, InsertArgTs...>::value>
+{};
+
+/**
+ * @brief Output iterator which discards all assigned values
+ *
+ * Used to apply extraction side-effects (e.g. removal of captured data) without copying data out of a queue
+ */
+struct DiscardOutputIterator
+{
+  using iterator_category = std::output_iterator_tag;
+  using value_type = void;
+  using difference_type = void;
+  using pointer = void;
+  using reference = void;
+
+  template <typename ValueT> constexpr DiscardOutputIterator& operator=(ValueT&&) { return *this; }
+
+  constexpr DiscardOutputIterator& operator*() { return *this; }
+
+  constexpr DiscardOutputIterator& operator++() { return *this; }
+
+  constexpr DiscardOutputIterator& operator++(int) { return *this; }
+};
+
+/**
+ * @brief Lockable which does nothing
+ *
+ * Stands in for a captor lock where no synchronization is needed (e.g. NoLock captors)
+ */
+struct NullLock
+{
+  constexpr void lock() const {}
+
+  constexpr bool try_lock() const { return true; }
+
+  constexpr void unlock() const {}
+};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+
 /**
  * @brief Basic captor traits struct with common type information from data dispatch object
  *
@@ -121,6 +277,9 @@ template <typename DispatchT> struct CaptorTraitsFromDispatch
 template <typename CaptorT> struct CaptorTraits;
 
 
+template <typename CaptorT> class CaptureView;
+
+
 /**
  * @brief CRTP-base which defines basic captor interface
  */
@@ -148,6 +307,9 @@ public:
   /// Integer size type
   using size_type = typename CaptorTraits<CaptorT>::size_type;
 
+  /// View of captured data, returned by <code>capture_view</code>
+  using view_type = CaptureView<CaptorT>;
+
   /**
    * @brief Full setup constructor
    *
@@ -163,10 +325,17 @@ public:
   /**
    * @brief Clears all captor data and resets all states
    */
-  inline void reset() { derived()->reset_impl(); }
+  inline void reset()
+  {
+    derived()->reset_impl();
+    notify_group();
+  }
 
   /**
    * @brief Returns the number of buffered elements
+   *
+   * @note Lock-free for multi-threaded captors, which publish queue metadata on every change to the queue; does not
+   *       contend with data injection or capture
    */
   inline size_type size() const { return derived()->size_impl(); }
 
@@ -182,7 +351,8 @@ public:
    */
   template <typename... DispatchConstructorArgTs> inline void inject(DispatchConstructorArgTs&&... dispatch_args)
   {
-    return derived()->inject_impl(std::forward<DispatchConstructorArgTs>(dispatch_args)...);
+    derived()->inject_impl(std::forward<DispatchConstructorArgTs>(dispatch_args)...);
+    notify_group();
   }
 
   /**
@@ -199,8 +369,9 @@ public:
   template <typename FirstForwardDispatchIteratorT, typename LastForwardDispatchIteratorT>
   inline void insert(FirstForwardDispatchIteratorT&& first, LastForwardDispatchIteratorT&& last)
   {
-    return derived()->insert_impl(
+    derived()->insert_impl(
       std::forward<FirstForwardDispatchIteratorT>(first), std::forward<LastForwardDispatchIteratorT>(last));
+    notify_group();
   }
 
   /**
@@ -208,7 +379,11 @@ public:
    *
    * @param t_abort  time before which data should be removed
    */
-  inline void remove(const stamp_type& t_remove) { return derived()->remove_impl(t_remove); }
+  inline void remove(const stamp_type& t_remove)
+  {
+    derived()->remove_impl(t_remove);
+    notify_group();
+  }
 
   /**
    * @brief Defines Captor behavior during an external abort
@@ -218,7 +393,11 @@ public:
    *
    * @param t_abort  time at which abort was signaled
    */
-  inline void abort(const stamp_type& t_abort) { return derived()->abort_impl(t_abort); }
+  inline void abort(const stamp_type& t_abort)
+  {
+    derived()->abort_impl(t_abort);
+    notify_group();
+  }
 
   /**
    * @brief Sets the maximum number of elements
@@ -241,14 +420,61 @@ public:
    */
   inline size_type get_capacity() const { return derived()->get_capacity_impl(); }
 
+  /**
+   * @brief Sets behavior used when new data arrives while the queue is at capacity
+   *
+   * Admission is checked before new data is inserted (and, where possible, before it is constructed)
+   *
+   * @param admission_policy  admission policy
+   */
+  inline void set_admission_policy(const AdmissionPolicy admission_policy)
+  {
+    return derived()->set_admission_policy_impl(admission_policy);
+  }
+
+  /**
+   * @brief Gets behavior used when new data arrives while the queue is at capacity
+   *
+   * @see <code>set_admission_policy</code>
+   */
+  inline AdmissionPolicy get_admission_policy() const { return derived()->get_admission_policy_impl(); }
+
+  /**
+   * @brief Gets counters of data discarded to respect capacity and admission policy, since construction
+   */
+  inline AdmissionStats get_admission_stats() const { return derived()->get_admission_stats_impl(); }
+
+  /**
+   * @brief Attaches captor to a group notifier, which is signaled whenever buffered data changes
+   *
+   * @param group_notifier  notifier shared by a group of captors; <code>nullptr</code> detaches captor from its group
+   *
+   * @warning Must not be called while other threads use this captor
+   */
+  inline void set_group_notifier(GroupNotifier* const group_notifier) { group_notifier_ = group_notifier; }
+
+  /**
+   * @brief Returns group notifier which captor is attached to, or <code>nullptr</code>
+   */
+  inline GroupNotifier* get_group_notifier() const { return group_notifier_; }
+
   /**
    * @brief Gets the time range between oldest/newest buffered messages
+   *
+   * @copydetails size
    */
   inline CaptureRange<stamp_type> get_available_stamp_range() const
   {
     return derived()->get_available_stamp_range_impl();
   }
 
+  /**
+   * @brief Gets counters describing how far out of order data has been inserted
+   *
+   * @see <code>DispatchQueue::get_insertion_stats</code>
+   */
+  inline InsertionStats get_insertion_stats() const { return derived()->get_insertion_stats_impl(); }
+
   /**
    * @brief Waits for ready state and captures inputs
    *
@@ -274,7 +500,8 @@ public:
   /**
    * @copydoc capture
    *
-   * @param timeout  time to stop waiting for data
+   * @param timeout  time to stop waiting for data; <code>time_point::min()</code> never waits, and
+   *                 <code>time_point::max()</code> waits indefinitely
    */
   template <typename OutputDispatchIteratorT, typename CaptureRangeT, typename ClockT, typename DurationT>
   inline std::tuple<State, OutputDispatchIteratorT> capture(
@@ -286,6 +513,43 @@ public:
     return std::make_tuple(state, output);
   }
 
+  /**
+   * @brief Waits for ready state and captures inputs as a view of queued data, without copying
+   *
+   * Locates data as with \c locate. When data is ready, captured elements are left in place and returned as a
+   * CaptureView which holds a lease on this Captor. Until that lease is released, all changes to the queue (injection,
+   * removal, abort and reset) are deferred, and are applied in order on release. Otherwise, extraction side-effects
+   * are applied immediately and an empty view is returned.
+   *
+   * Any previous lease is released before capture
+   *
+   * @tparam CaptureRangeT  message capture stamp range type
+   *
+   * @param[in,out] range  data capture/sequencing range
+   *
+   * @return <code>{capture directive code, view of captured data}</code>
+   *
+   * @note Not supported by captors which output data other than located queue elements, like follower::Latched
+   */
+  template <typename CaptureRangeT> inline std::tuple<State, CaptureView<CaptorT>> capture_view(CaptureRangeT&& range)
+  {
+    return derived()->capture_view_impl(std::forward<CaptureRangeT>(range));
+  }
+
+  /**
+   * @copydoc capture_view
+   *
+   * @param timeout  time to stop waiting for data; <code>time_point::min()</code> never waits, and
+   *                 <code>time_point::max()</code> waits indefinitely
+   */
+  template <typename CaptureRangeT, typename ClockT, typename DurationT>
+  inline std::tuple<State, CaptureView<CaptorT>> capture_view(
+    CaptureRangeT&& range,
+    const std::chrono::time_point<ClockT, DurationT> timeout = std::chrono::time_point<ClockT, DurationT>::max())
+  {
+    return derived()->capture_view_impl(std::forward<CaptureRangeT>(range), timeout);
+  }
+
   /**
    * @brief Finds element range to extract on synchronization
    *
@@ -305,7 +569,8 @@ public:
   /**
    * @copydoc locate
    *
-   * @param timeout  time to stop waiting for data
+   * @param timeout  time to stop waiting for data; <code>time_point::min()</code> never waits, and
+   *                 <code>time_point::max()</code> waits indefinitely
    */
   template <typename CaptureRangeT, typename ClockT, typename DurationT>
   inline std::tuple<State, ExtractionRange> locate(
@@ -340,7 +605,9 @@ public:
   /**
    * @brief Runs inspection callback all messages available in the current queue
    *
-   * The queue and its contents will be immutable during inspection
+   * The queue and its contents will be immutable during inspection. When the captor mutex is a shared mutex,
+   * concurrent inspections do not serialize with each other, but injection and capture wait until all inspections
+   * have returned; callbacks should copy out what they need rather than doing heavy work in place.
    *
    * @tparam InpectCallbackT  queue inspection callback type which can be called as
    *                   <code>cb(const DispatchType& dispatch)</code>
@@ -365,6 +632,83 @@ public:
     derived()->update_queue_monitor_impl(std::forward<CaptureRangeT>(range), sync_state);
   }
 
+  /**
+   * @brief Returns a lock on this captor's queue which has not yet been acquired
+   *
+   * The returned object is Lockable (https://en.cppreference.com/w/cpp/named_req/Lockable) so that locks on several
+   * captors may be acquired together with <code>std::lock</code>. Used with \c locate_locked and \c extract_locked to
+   * run locate, extract and queue monitor updates under a single lock.
+   */
+  inline auto defer_lock() { return derived()->defer_lock_impl(); }
+
+  /**
+   * @brief Finds elements to extract from the queue without waiting for data
+   *
+   * @tparam CaptureRangeT  message capture stamp range type
+   *
+   * @param range  data capture/sequencing range
+   *
+   * @return {capture state, range of elements to extract}
+   *
+   * @warning Must be called while holding the lock returned by \c defer_lock
+   */
+  template <typename CaptureRangeT> inline std::tuple<State, ExtractionRange> locate_locked(CaptureRangeT&& range)
+  {
+    return derived()->locate_locked_impl(std::forward<CaptureRangeT>(range));
+  }
+
+  /**
+   * @brief Extracts elements found with \c locate_locked and updates queue monitor with global synchronization state
+   *
+   * @tparam OutputDispatchIteratorT  output iterator type for a value type which supports assignment with
+   * <code>DispatchType</code>
+   *
+   * @param[out] output  output data iterator
+   * @param extraction_range  range of elements to extract (by copy or move) from queue
+   * @param range  data capture/sequencing range, from Sychronizer
+   * @param sync_state  global synchronization state, from Sychronizer
+   *
+   * @return \c output iterator, advanced if elements were extracted
+   *
+   * @warning Must be called while holding the lock returned by \c defer_lock
+   */
+  template <typename OutputDispatchIteratorT>
+  inline OutputDispatchIteratorT extract_locked(
+    OutputDispatchIteratorT output,
+    const ExtractionRange& extraction_range,
+    const CaptureRange<stamp_type>& range,
+    const State sync_state)
+  {
+    derived()->extract_locked_impl(output, extraction_range, range, sync_state);
+    return output;
+  }
+
+  /**
+   * @brief Returns a counter which changes whenever queued data, or capture state which depends on it, changes
+   *
+   * Results of \c locate_locked remain valid for as long as this counter is unchanged. Taking a lease (see
+   * \c capture_view) leaves queued data in place, but also changes this counter.
+   *
+   * @see <code>DispatchQueue::generation</code>
+   *
+   * @warning Must be called while holding the lock returned by \c defer_lock
+   */
+  inline std::uint64_t generation_locked() const { return queue_.generation() + lease_.id; }
+
+  /**
+   * @brief Returns the number of elements which \c extract_locked will output for \p extraction_range
+   *
+   * Used to size output buffers before data is captured
+   *
+   * @param extraction_range  range of elements to extract, from \c locate_locked
+   *
+   * @warning Must be called while holding the lock returned by \c defer_lock
+   */
+  inline size_type extract_size_locked(const ExtractionRange& extraction_range) const
+  {
+    return derived()->extract_size_locked_impl(extraction_range);
+  }
+
   // Sanity check to ensure that DispatchType is copyable
   FLOW_STATIC_ASSERT(std::is_copy_constructible<DispatchType>(), "'DispatchType' must be a copyable type");
 
@@ -372,22 +716,349 @@ protected:
   /**
    * @brief Inserts data into queue and limit queue size to capacity, if applicable
    *
-   * @param args  args forward to <code>DispatchQueue::insert</code>
+   * New data is checked against <code>admission_policy_</code> before it is inserted. When its stamp can be read
+   * from \p args directly (a <code>DispatchType</code> or stamp-first <code>Dispatch</code> constructor arguments),
+   * this check happens before a new <code>DispatchType</code> is constructed.
    *
-   * @return capture directive code
+   * @param args  args forward to <code>DispatchQueue::insert</code>
    */
   template <typename... InsertArgTs> inline void insert_and_limit(InsertArgTs&&... args);
 
+  /**
+   * @brief Copies a range of data and sorts it by sequence stamp
+   *
+   * Used to prepare data for <code>merge_and_limit</code> before any locks are acquired
+   *
+   * @param first  iterator to first Dispatch in range
+   * @param last  iterator to one past last Dispatch in range
+   *
+   * @return Dispatch elements, stably sorted by stamp
+   */
+  template <typename FirstForwardDispatchIteratorT, typename LastForwardDispatchIteratorT>
+  static inline std::vector<DispatchType>
+  sort_by_stamp(FirstForwardDispatchIteratorT first, LastForwardDispatchIteratorT last);
+
+  /**
+   * @brief Merges a sorted range of data into queue in a single pass, limiting queue size to capacity, if applicable
+   *
+   * @param sorted_dispatches  Dispatch elements, sorted by stamp (see <code>sort_by_stamp</code>); elements are moved
+   *                           into the queue, so that the locked section never copies data
+   */
+  inline void merge_and_limit(std::vector<DispatchType>&& sorted_dispatches);
+
+  /**
+   * @brief Publishes current queue size and stamp range, for reads with <code>load_queue_metadata</code>
+   *
+   * @note Must be called under lock, after any change to <code>queue_</code>
+   */
+  inline void publish_queue_metadata();
+
+  /**
+   * @brief Returns queue size and stamp range as of the last call to <code>publish_queue_metadata</code>
+   *
+   * @note Lock-free; may be called while another thread modifies <code>queue_</code> under lock
+   */
+  inline QueueMetadata<stamp_type> load_queue_metadata() const { return queue_metadata_.load(); }
+
   /// Buffered data capacity
   size_type capacity_;
 
+  /// Behavior when new data arrives while queue is at capacity
+  AdmissionPolicy admission_policy_ = AdmissionPolicy::DROP_OLDEST;
+
+  /// Counters of data discarded to respect capacity and admission policy
+  AdmissionStats admission_stats_;
+
   /// Data dispatch queue
   DispatchQueue<DispatchType, DispatchContainerType, AccessStampType, AccessValueType> queue_;
 
   /// Data dispatch queue capture monitor check
   DispatchQueueMonitorType queue_monitor_;
 
+  /// Queue size and stamp range, for lock-free reads
+  SeqLock<QueueMetadata<stamp_type>> queue_metadata_;
+
+  /**
+   * @brief Queue changes which are deferred while captured data is leased to a CaptureView
+   */
+  enum class DeferredOperation : int
+  {
+    REMOVE,
+    ABORT,
+    RESET,
+  };
+
+  /**
+   * @brief Checks if captured data is leased to a CaptureView
+   *
+   * Changes to <code>queue_</code> must be deferred while leased
+   */
+  inline bool is_leased() const { return lease_.active; }
+
+  /**
+   * @brief Checks if captured data is leased to the CaptureView with \p lease_id
+   */
+  inline bool is_leased(const std::size_t lease_id) const { return lease_.active and lease_.id == lease_id; }
+
+  /**
+   * @brief Defers a removal, abort or reset until the current lease is released
+   *
+   * @param operation  deferred operation
+   * @param stamp  removal or abort stamp, if applicable
+   */
+  inline void defer(const DeferredOperation operation, const stamp_type& stamp = stamp_type{});
+
+  /**
+   * @brief Leases captured data to a new CaptureView
+   *
+   * If there is nothing to view, extraction side-effects are applied immediately, and an empty view is returned
+   *
+   * @param state  capture state, from <code>locate</code>
+   * @param extraction_range  range of captured elements
+   * @param range  data capture/sequencing range, after <code>locate</code>
+   * @param extract_fn  callable as <code>extract_fn(output, extraction_range, range)</code>; runs captor extraction
+   *
+   * @return <code>{capture directive code, view of captured data}</code>
+   */
+  template <typename ExtractFnT>
+  inline std::tuple<State, CaptureView<CaptorT>> lease(
+    const State state,
+    const ExtractionRange& extraction_range,
+    const CaptureRange<stamp_type>& range,
+    ExtractFnT&& extract_fn);
+
+  /**
+   * @brief Releases the current lease, if any
+   *
+   * Applies deferred extraction of leased data, followed by deferred queue changes in the order they were requested
+   *
+   * @param extract_fn  callable as <code>extract_fn(output, extraction_range, range)</code>; runs captor extraction
+   * @param abort_fn  callable as <code>abort_fn(t_abort)</code>; runs captor abort behavior
+   * @param reset_fn  callable as <code>reset_fn()</code>; runs captor reset behavior
+   *
+   * @retval true  if a lease was released
+   * @retval false  otherwise
+   */
+  template <typename ExtractFnT, typename AbortFnT, typename ResetFnT>
+  inline bool end_lease(ExtractFnT&& extract_fn, AbortFnT&& abort_fn, ResetFnT&& reset_fn);
+
   FLOW_IMPLEMENT_CRTP_BASE(CaptorT);
+
+private:
+  friend class CaptureView<CaptorT>;
+
+  /**
+   * @brief Releases lease held by a CaptureView
+   */
+  inline void release_lease(const std::size_t lease_id)
+  {
+    derived()->release_lease_impl(lease_id);
+    notify_group();
+  }
+
+  /**
+   * @brief Signals group notifier, if attached, that buffered data may have changed
+   */
+  inline void notify_group()
+  {
+    if (group_notifier_ != nullptr)
+    {
+      group_notifier_->notify();
+    }
+  }
+
+  /// Notifier shared by a group of captors
+  GroupNotifier* group_notifier_ = nullptr;
+
+  /**
+   * @brief Captured data leased to a CaptureView
+   */
+  struct Lease
+  {
+    /// Identifies lease, such that stale views cannot release a newer lease
+    std::size_t id = 0UL;
+
+    /// Lease is held
+    bool active = false;
+
+    /// Range of leased elements
+    ExtractionRange extraction_range;
+
+    /// Data capture/sequencing range used to capture leased elements
+    CaptureRange<stamp_type> range;
+  };
+
+  /**
+   * @brief Removal, abort or reset requested while leased
+   */
+  struct DeferredRecord
+  {
+    /// Deferred operation
+    DeferredOperation operation;
+
+    /// Removal or abort stamp
+    stamp_type stamp;
+
+    /// Number of deferred dispatches inserted before this operation was requested
+    std::size_t preceding_dispatch_count;
+  };
+
+  /// Current lease
+  Lease lease_;
+
+  /// Data inserted while leased
+  std::vector<DispatchType> deferred_dispatches_;
+
+  /// Queue changes requested while leased
+  std::vector<DeferredRecord> deferred_records_;
+
+  /// Checks if the stamp of new data can be read from its <code>DispatchType</code> constructor arguments
+  template <typename... InsertArgTs>
+  using CanPeekStamp = detail::CanPeekStamp<DispatchType, AccessStampType, InsertArgTs...>;
+
+  /**
+   * @brief Applies admission policy to new data with \p stamp
+   *
+   * @retval true  if new data should be inserted
+   * @retval false  if new data should be discarded
+   */
+  inline bool admit(const stamp_type& stamp);
+
+  template <typename... InsertArgTs> inline void insert_and_limit_impl(std::true_type, InsertArgTs&&... args);
+
+  template <typename... InsertArgTs> inline void insert_and_limit_impl(std::false_type, InsertArgTs&&... args);
+
+  /// Returns stamp of an existing <code>DispatchType</code>
+  static inline stamp_type peek_stamp(const DispatchType& dispatch) { return AccessStampType::get(dispatch); }
+
+  /// Returns stamp from stamp-first <code>Dispatch</code> constructor arguments
+  template <typename StampArgT, typename... ValueArgTs>
+  static inline stamp_type peek_stamp(const StampArgT& stamp, const ValueArgTs&... value_args)
+  {
+    return stamp;
+  }
+};
+
+
+/**
+ * @brief Read-only view of captured data which is left in place in a Captor queue
+ *
+ * Holds a lease on its Captor. While the lease is held, the Captor defers all changes to its queue, such that viewed
+ * elements are neither copied, moved nor removed. The lease is released when the view is destroyed, when
+ * <code>CaptureView::release</code> is called, or when the Captor next captures data.
+ *
+ * @tparam CaptorT  CRTP-derived Captor type
+ *
+ * @warning Iterators are invalidated once the lease is released. A view must not outlive its Captor.
+ */
+template <typename CaptorT> class CaptureView
+{
+public:
+  /// Iterator over viewed dispatches
+  using const_iterator = typename CaptorTraits<CaptorT>::DispatchContainerType::const_iterator;
+
+  /// Integer size type
+  using size_type = typename CaptorTraits<CaptorT>::size_type;
+
+  /**
+   * @brief Empty view without a lease
+   */
+  CaptureView() = default;
+
+  CaptureView(CaptureView&& other) :
+      captor_{other.captor_},
+      lease_id_{other.lease_id_},
+      first_{other.first_},
+      last_{other.last_}
+  {
+    other.captor_ = nullptr;
+  }
+
+  CaptureView& operator=(CaptureView&& other)
+  {
+    if (this != &other)
+    {
+      release();
+      captor_ = other.captor_;
+      lease_id_ = other.lease_id_;
+      first_ = other.first_;
+      last_ = other.last_;
+      other.captor_ = nullptr;
+    }
+    return *this;
+  }
+
+  CaptureView(const CaptureView&) = delete;
+
+  CaptureView& operator=(const CaptureView&) = delete;
+
+  /**
+   * @brief Destructor
+   * @note Releases lease
+   */
+  ~CaptureView() { release(); }
+
+  /**
+   * @brief Returns iterator to first viewed dispatch
+   */
+  inline const_iterator begin() const { return first_; }
+
+  /**
+   * @brief Returns iterator to one past last viewed dispatch
+   */
+  inline const_iterator end() const { return last_; }
+
+  /**
+   * @brief Returns number of viewed dispatches
+   */
+  inline size_type size() const { return static_cast<size_type>(std::distance(first_, last_)); }
+
+  /**
+   * @brief Checks if view is empty
+   */
+  inline bool empty() const { return first_ == last_; }
+
+  /**
+   * @brief Checks if view holds a lease on its Captor
+   */
+  inline bool leased() const { return captor_ != nullptr; }
+
+  /**
+   * @brief Releases lease, applying changes to the Captor queue which were deferred while leased
+   *
+   * View is empty after release
+   */
+  inline void release()
+  {
+    if (captor_ != nullptr)
+    {
+      captor_->release_lease(lease_id_);
+      captor_ = nullptr;
+    }
+    first_ = last_;
+  }
+
+private:
+  friend class CaptorInterface<CaptorT>;
+
+  CaptureView(CaptorInterface<CaptorT>* captor, const std::size_t lease_id, const_iterator first, const_iterator last) :
+      captor_{captor},
+      lease_id_{lease_id},
+      first_{first},
+      last_{last}
+  {}
+
+  /// Leasing captor
+  CaptorInterface<CaptorT>* captor_ = nullptr;
+
+  /// Lease identifier
+  std::size_t lease_id_ = 0UL;
+
+  /// Iterator to first viewed dispatch
+  const_iterator first_{};
+
+  /// Iterator to one past last viewed dispatch
+  const_iterator last_{};
 };
 
 
@@ -398,11 +1069,15 @@ protected:
  * - <code>#include <flow/captor/lockable.hpp></code>
  * - <code>#include <flow/captor/nolock.hpp></code>
  * - <code>#include <flow/captor/polling.hpp></code>
+ * - <code>#include <flow/captor/mpsc.hpp></code>
+ * - <code>#include <flow/captor/spsc.hpp></code>
  *
  * @tparam CaptorT  CRTP-derived Captor type
  * @tparam LockableT  a TimedLockable (https://en.cppreference.com/w/cpp/named_req/TimedLockable) object;
- *         specializations are available which replace <code>LockableT</code> with <code>NoLock</code> or
- *         <code>PollingLock</code>
+ *         specializations are available which replace <code>LockableT</code> with <code>NoLock</code>,
+ *         <code>PollingLock</code>, <code>SPSCLane</code> or <code>MPSCLane</code>; the captor mutex is
+ *         <code>LockableT::mutex_type</code> (e.g. <code>std::unique_lock<flow::AdaptiveMutex></code>); when it is
+ *         a shared mutex (e.g. <code>std::shared_timed_mutex</code>), read-only operations take a shared lock
  * @tparam QueueMonitorT  object used to monitor queue state on each insertion; used to precondition capture
  */
 template <typename CaptorT, typename LockableT, typename QueueMonitorT> class Captor;
@@ -451,6 +1126,15 @@ template <typename LockableT> struct is_polling_lock : std::integral_constant<bo
 {};
 
 
+/**
+ * @brief Checks if <code>LockableT</code> is an injection lane policy, like SPSCLane or MPSCLane
+ *
+ * @tparam CaptorT  object to test
+ */
+template <typename LockableT> struct is_injection_lane : std::integral_constant<bool, false>
+{};
+
+
 /**
  * @brief Checks if captor is serviced by polling capture
  *
@@ -460,7 +1144,8 @@ template <typename CaptorT>
 struct is_polling : std::integral_constant<
                       bool,
                       is_polling_lock<typename CaptorTraits<CaptorT>::LockPolicyType>::value or
-                        is_no_lock<typename CaptorTraits<CaptorT>::LockPolicyType>::value>
+                        is_no_lock<typename CaptorTraits<CaptorT>::LockPolicyType>::value or
+                        is_injection_lane<typename CaptorTraits<CaptorT>::LockPolicyType>::value>
 {};
 
 }  // namespace flow
@@ -0,0 +1,398 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_CAPTURE_CAPTOR_LANE_H
+#define FLOW_CAPTURE_CAPTOR_LANE_H
+
+// C++ Standard Library
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <iterator>
+#include <mutex>
+#include <type_traits>
+
+// Flow
+#include <flow/captor.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Stand-in type used to signify that captors are fed through a lock-free injection lane, and polled for capture
+ *
+ * <code>Captor::inject</code> pushes new data into a bounded ring (the injection lane), and never blocks on capture.
+ * Data in the lane is drained into the captor queue, where it is ordered by stamp and subject to capacity and
+ * admission policy, before each capture attempt. All other captor methods are called on the consumer side, and are
+ * serialized with a mutex.
+ * \n
+ * New data is rejected, and counted in <code>AdmissionStats::rejected</code>, when the lane is full
+ *
+ * Use through one of the following aliases:
+ * - <code>SPSCLane</code> (<code>#include <flow/captor/spsc.hpp></code>) for a single producer thread
+ * - <code>MPSCLane</code> (<code>#include <flow/captor/mpsc.hpp></code>) for several producer threads
+ *
+ * @tparam RingTmpl  ring template, instantiated as <code>RingTmpl<DispatchType, LaneCapacity></code>, which provides
+ *                   <code>try_emplace</code>, <code>consume_all</code> and <code>size</code>
+ * @tparam LaneCapacity  maximum number of elements waiting in the injection lane; must be a power of two
+ */
+template <template <typename, std::size_t> class RingTmpl, std::size_t LaneCapacity> struct InjectionLane
+{
+  /// Injection lane capacity
+  static constexpr std::size_t capacity = LaneCapacity;
+};
+
+
+/**
+ * @copydoc Captor
+ * @note Captor implementation with a lock-free injection lane, meant for polling with <code>Captor::capture</code>.
+ */
+template <
+  typename CaptorT,
+  template <typename, std::size_t>
+  class RingTmpl,
+  std::size_t LaneCapacity,
+  typename QueueMonitorT>
+class Captor<CaptorT, InjectionLane<RingTmpl, LaneCapacity>, QueueMonitorT>
+    : public CaptorInterface<Captor<CaptorT, InjectionLane<RingTmpl, LaneCapacity>, QueueMonitorT>>
+{
+public:
+  /// Data dispatch type
+  using DispatchType = typename CaptorTraits<CaptorT>::DispatchType;
+
+  /// Underlying dispatch container type
+  using DispatchContainerType = typename CaptorTraits<CaptorT>::DispatchContainerType;
+
+  /// Data stamp type
+  using stamp_type = typename CaptorTraits<CaptorT>::stamp_type;
+
+  /// Integer size type
+  using size_type = typename CaptorTraits<CaptorT>::size_type;
+
+  /**
+   * @brief Dispatch container constructor
+   *
+   * @param container  container object with some initial state
+   * @param queue_monitor  custom implementation for checking the state of the queue and preconditioning capture
+   *
+   * @note Initializes data capacity with NO LIMITS on buffer size
+   */
+  Captor(const DispatchContainerType& container, const QueueMonitorT& queue_monitor) :
+      CaptorInterfaceType{0UL, container, queue_monitor}
+  {}
+
+  /**
+   * @brief Destructor
+   */
+  ~Captor() = default;
+
+private:
+  /**
+   * @copydoc CaptorInterface::reset
+   */
+  inline void reset_impl()
+  {
+    LockType lock{queue_mutex_};
+
+    // Discard data which has not been drained
+    lane_.consume_all([](DispatchType&&) {});
+
+    // Run reset behavior specific to this captor
+    derived()->reset_policy_impl();
+
+    // Remove all data
+    CaptorInterfaceType::queue_.clear();
+    CaptorInterfaceType::publish_queue_metadata();
+  }
+
+  /**
+   * @copydoc CaptorInterface::abort
+   */
+  inline void abort_impl(const stamp_type& t_abort)
+  {
+    LockType lock{queue_mutex_};
+    drain();
+
+    // Run abort behavior specific to this captor
+    derived()->abort_policy_impl(t_abort);
+    CaptorInterfaceType::publish_queue_metadata();
+  }
+
+  /**
+   * @copydoc CaptorInterface::size
+   */
+  inline size_type size_impl() const
+  {
+    // Lock-free; does not contend with inject or capture
+    return CaptorInterfaceType::load_queue_metadata().size + lane_.size();
+  }
+
+  /**
+   * @copydoc CaptorInterface::inject
+   */
+  template <typename... DispatchConstructorArgTs> inline void inject_impl(DispatchConstructorArgTs&&... dispatch_args)
+  {
+    if (!lane_.try_emplace(std::forward<DispatchConstructorArgTs>(dispatch_args)...))
+    {
+      lane_rejected_.fetch_add(1UL, std::memory_order_relaxed);
+    }
+  }
+
+  /**
+   * @copydoc CaptorInterface::insert
+   */
+  template <typename FirstForwardDispatchIteratorT, typename LastForwardDispatchIteratorT>
+  inline void insert_impl(FirstForwardDispatchIteratorT first, LastForwardDispatchIteratorT last)
+  {
+    for (; first != last; ++first)
+    {
+      inject_impl(*first);
+    }
+  }
+
+  /**
+   * @copydoc CaptorInterface::remove
+   */
+  inline void remove_impl(const stamp_type& t_remove)
+  {
+    LockType lock{queue_mutex_};
+    drain();
+
+    // Remove all data before this time
+    CaptorInterfaceType::queue_.remove_before(t_remove);
+    CaptorInterfaceType::publish_queue_metadata();
+  }
+
+  /**
+   * @copydoc CaptorInterface::set_capacity
+   */
+  inline void set_capacity_impl(const size_type capacity)
+  {
+    LockType lock{queue_mutex_};
+    CaptorInterfaceType::capacity_ = capacity;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_capacity
+   */
+  inline size_type get_capacity_impl() const
+  {
+    LockType lock{queue_mutex_};
+    return CaptorInterfaceType::capacity_;
+  }
+
+  /**
+   * @copydoc CaptorInterface::set_admission_policy
+   */
+  inline void set_admission_policy_impl(const AdmissionPolicy admission_policy)
+  {
+    LockType lock{queue_mutex_};
+    CaptorInterfaceType::admission_policy_ = admission_policy;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_admission_policy
+   */
+  inline AdmissionPolicy get_admission_policy_impl() const
+  {
+    LockType lock{queue_mutex_};
+    return CaptorInterfaceType::admission_policy_;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_admission_stats
+   */
+  inline AdmissionStats get_admission_stats_impl() const
+  {
+    LockType lock{queue_mutex_};
+    AdmissionStats admission_stats{CaptorInterfaceType::admission_stats_};
+    admission_stats.rejected += lane_rejected_.load(std::memory_order_relaxed);
+    return admission_stats;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_available_stamp_range
+   */
+  inline CaptureRange<stamp_type> get_available_stamp_range_impl() const
+  {
+    // Lock-free; does not contend with inject or capture
+    return CaptorInterfaceType::load_queue_metadata().range;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_insertion_stats
+   */
+  inline InsertionStats get_insertion_stats_impl() const
+  {
+    LockType lock{queue_mutex_};
+    return queue_.get_insertion_stats();
+  }
+
+  /**
+   * @copydoc CaptorInterface::capture
+   */
+  template <typename OutputDispatchIteratorT, typename CaptureRangeT>
+  inline State capture_impl(OutputDispatchIteratorT& output, CaptureRangeT&& range)
+  {
+    LockType lock{queue_mutex_};
+    drain();
+    const auto size_before_capture = CaptorInterfaceType::queue_.size();
+    const State state = derived()->capture_policy_impl(output, std::forward<CaptureRangeT>(range));
+
+    // Capture only ever removes data; skip publishing when polling left the queue as it was
+    if (CaptorInterfaceType::queue_.size() != size_before_capture)
+    {
+      CaptorInterfaceType::publish_queue_metadata();
+    }
+    return state;
+  }
+
+  /**
+   * @copydoc CaptorInterface::locate
+   */
+  template <typename CaptureRangeT> inline std::tuple<State, ExtractionRange> locate_impl(CaptureRangeT&& range)
+  {
+    LockType lock{queue_mutex_};
+    drain();
+    return derived()->locate_policy_impl(std::forward<CaptureRangeT>(range));
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_impl
+   */
+  template <typename OutputDispatchIteratorT>
+  inline void extract_impl(
+    OutputDispatchIteratorT& output,
+    const ExtractionRange& extraction_range,
+    const CaptureRange<stamp_type>& range)
+  {
+    LockType lock{queue_mutex_};
+    derived()->extract_policy_impl(output, extraction_range, range);
+    CaptorInterfaceType::publish_queue_metadata();
+  }
+
+  /**
+   * @copydoc CaptorInterface::defer_lock
+   */
+  inline std::unique_lock<std::mutex> defer_lock_impl()
+  {
+    return std::unique_lock<std::mutex>{queue_mutex_, std::defer_lock};
+  }
+
+  /**
+   * @copydoc CaptorInterface::locate_locked
+   */
+  template <typename CaptureRangeT> inline std::tuple<State, ExtractionRange> locate_locked_impl(CaptureRangeT&& range)
+  {
+    drain();
+    return derived()->locate_policy_impl(std::forward<CaptureRangeT>(range));
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_size_locked
+   */
+  inline size_type extract_size_locked_impl(const ExtractionRange& extraction_range) const
+  {
+    return derived()->extract_size_policy_impl(extraction_range);
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_locked
+   */
+  template <typename OutputDispatchIteratorT>
+  inline void extract_locked_impl(
+    OutputDispatchIteratorT& output,
+    const ExtractionRange& extraction_range,
+    const CaptureRange<stamp_type>& range,
+    const State sync_state)
+  {
+    derived()->extract_policy_impl(output, extraction_range, range);
+    CaptorInterfaceType::queue_monitor_.update(CaptorInterfaceType::queue_, range, sync_state);
+    CaptorInterfaceType::publish_queue_metadata();
+  }
+
+  /**
+   * @copydoc CaptorInterface::capture
+   */
+  template <typename InpectCallbackT> void inspect_impl(InpectCallbackT&& inspect_dispatch_cb) const
+  {
+    LockType lock{queue_mutex_};
+    for (const auto& dispatch : CaptorInterfaceType::queue_)
+    {
+      inspect_dispatch_cb(dispatch);
+    }
+  }
+
+  /**
+   * @copydoc CaptorInterface::update_monitor
+   */
+  template <typename CaptureRangeT> void update_queue_monitor_impl(CaptureRangeT&& range, const State sync_state)
+  {
+    LockType lock{queue_mutex_};
+    CaptorInterfaceType::queue_monitor_.update(
+      CaptorInterfaceType::queue_, std::forward<CaptureRangeT>(range), sync_state);
+    CaptorInterfaceType::publish_queue_metadata();
+  }
+
+  /**
+   * @brief Moves all data waiting in the injection lane into the queue
+   *
+   * @note Must be called under lock
+   */
+  inline void drain()
+  {
+    std::size_t drained = 0UL;
+    try
+    {
+      drained = lane_.consume_all([this](DispatchType&& dispatch) {
+        CaptorInterfaceType::insert_and_limit(std::move(dispatch));
+      });
+    }
+    catch (...)
+    {
+      // Elements inserted before the failure are still published
+      CaptorInterfaceType::publish_queue_metadata();
+      throw;
+    }
+
+    if (drained)
+    {
+      CaptorInterfaceType::publish_queue_metadata();
+    }
+  }
+
+  /// Lock type used on the consumer side
+  using LockType = std::lock_guard<std::mutex>;
+
+  /// Mutex to serialize consumer side access to queue and injection lane
+  mutable std::mutex queue_mutex_;
+
+  /// Lock-free injection lane
+  RingTmpl<DispatchType, LaneCapacity> lane_;
+
+  /// Number of elements rejected because the injection lane was full
+  std::atomic<size_type> lane_rejected_{0UL};
+
+  using CaptorInterfaceType = CaptorInterface<Captor<CaptorT, InjectionLane<RingTmpl, LaneCapacity>, QueueMonitorT>>;
+  friend CaptorInterfaceType;
+
+  FLOW_IMPLEMENT_CRTP_BASE(CaptorT);
+
+protected:
+  using CaptorInterfaceType::queue_;
+};
+
+
+/**
+ * @copydoc is_injection_lane
+ *
+ * @note true case
+ */
+template <template <typename, std::size_t> class RingTmpl, std::size_t LaneCapacity>
+struct is_injection_lane<InjectionLane<RingTmpl, LaneCapacity>> : std::integral_constant<bool, true>
+{};
+
+}  // namespace flow
+
+#endif  // FLOW_CAPTURE_CAPTOR_LANE_H
@@ -16,6 +16,7 @@
 
 // Flow
 #include <flow/captor.hpp>
+#include <flow/utility/shared_lock.hpp>
 
 namespace flow
 {
@@ -64,6 +65,12 @@ public:
   ~Captor() { abort_impl(StampTraits<stamp_type>::max()); }
 
 private:
+  /// Mutex type locked by <code>LockableT</code>
+  using MutexType = typename LockableT::mutex_type;
+
+  /// Lock used by read-only operations; shared when <code>MutexType</code> is <code>SharedLockable</code>
+  using ReadLockType = ReadLock<MutexType, LockableT>;
+
   /**
    * @copydoc CaptorInterface::reset
    */
@@ -75,11 +82,19 @@ private:
       // Indicate that capture should stop
       capturing_ = false;
 
-      // Run reset behavior specific to this captor
-      derived()->reset_policy_impl();
+      if (CaptorInterfaceType::is_leased())
+      {
+        CaptorInterfaceType::defer(CaptorInterfaceType::DeferredOperation::RESET);
+      }
+      else
+      {
+        // Run reset behavior specific to this captor
+        derived()->reset_policy_impl();
 
-      // Remove all data
-      CaptorInterfaceType::queue_.clear();
+        // Remove all data
+        CaptorInterfaceType::queue_.clear();
+      }
+      CaptorInterfaceType::publish_queue_metadata();
     }
 
     // Release capture waits
@@ -91,8 +106,8 @@ private:
    */
   inline size_type size_impl() const
   {
-    LockableT lock{capture_mutex_};
-    return CaptorInterfaceType::queue_.size();
+    // Lock-free; does not contend with inject or capture
+    return CaptorInterfaceType::load_queue_metadata().size;
   }
 
   /**
@@ -100,14 +115,23 @@ private:
    */
   template <typename... DispatchConstructorArgTs> inline void inject_impl(DispatchConstructorArgTs&&... dispatch_args)
   {
+    // Build new data before locking, so that the critical section only moves it into place
+    DispatchType dispatch{std::forward<DispatchConstructorArgTs>(dispatch_args)...};
+
+    bool wake = false;
     {
       // Insert new data
       LockableT lock{capture_mutex_};
-      CaptorInterfaceType::insert_and_limit(std::forward<DispatchConstructorArgTs>(dispatch_args)...);
+      CaptorInterfaceType::insert_and_limit(std::move(dispatch));
+      CaptorInterfaceType::publish_queue_metadata();
+      wake = wake_threshold_.is_met(CaptorInterfaceType::queue_);
     }
 
-    // Notify that new data has arrived
-    capture_cv_.notify_one();
+    // Notify that new data has arrived, only if a waiting capture could change state
+    if (wake)
+    {
+      capture_cv_.notify_one();
+    }
   }
 
   /**
@@ -116,15 +140,23 @@ private:
   template <typename FirstForwardDispatchIteratorT, typename LastForwardDispatchIteratorT>
   inline void insert_impl(FirstForwardDispatchIteratorT first, LastForwardDispatchIteratorT last)
   {
+    // Sort new data before locking
+    auto sorted_dispatches = CaptorInterfaceType::sort_by_stamp(first, last);
+
+    bool wake = false;
     {
       // Insert new data
       LockableT lock{capture_mutex_};
-      std::for_each(
-        first, last, [this](const DispatchType& dispatch) { CaptorInterfaceType::insert_and_limit(dispatch); });
+      CaptorInterfaceType::merge_and_limit(std::move(sorted_dispatches));
+      CaptorInterfaceType::publish_queue_metadata();
+      wake = wake_threshold_.is_met(CaptorInterfaceType::queue_);
     }
 
-    // Notify that new data has arrived
-    capture_cv_.notify_one();
+    // Notify that new data has arrived, only if a waiting capture could change state
+    if (wake)
+    {
+      capture_cv_.notify_one();
+    }
   }
 
   /**
@@ -135,7 +167,15 @@ private:
     {
       // Remove all data before this time
       LockableT lock{capture_mutex_};
-      CaptorInterfaceType::queue_.remove_before(t_remove);
+      if (CaptorInterfaceType::is_leased())
+      {
+        CaptorInterfaceType::defer(CaptorInterfaceType::DeferredOperation::REMOVE, t_remove);
+      }
+      else
+      {
+        CaptorInterfaceType::queue_.remove_before(t_remove);
+      }
+      CaptorInterfaceType::publish_queue_metadata();
     }
 
     // Notify that data has changed
@@ -154,8 +194,16 @@ private:
       // Indicate that capture should stop
       capturing_ = false;
 
-      // Run abort behavior specific to this captor
-      derived()->abort_policy_impl(t_abort);
+      if (CaptorInterfaceType::is_leased())
+      {
+        CaptorInterfaceType::defer(CaptorInterfaceType::DeferredOperation::ABORT, t_abort);
+      }
+      else
+      {
+        // Run abort behavior specific to this captor
+        derived()->abort_policy_impl(t_abort);
+      }
+      CaptorInterfaceType::publish_queue_metadata();
     }
 
     // Release capture waits
@@ -172,6 +220,7 @@ private:
     const std::chrono::time_point<ClockT, DurationT> timeout)
   {
     LockableT lock{capture_mutex_};
+    end_lease();
 
     // Wait for data and attempt capture when data is available
     State state{State::ABORT};
@@ -185,7 +234,16 @@ private:
       {
         break;
       }
-      else if (std::chrono::time_point<ClockT, DurationT>::max() == timeout)
+      else if (std::chrono::time_point<ClockT, DurationT>::min() == timeout)
+      {
+        // Do not wait at all
+        state = State::TIMEOUT;
+        break;
+      }
+
+      // Wait until data which could change capture state arrives
+      wake_threshold_ = derived()->wake_threshold_policy_impl(range);
+      if (std::chrono::time_point<ClockT, DurationT>::max() == timeout)
       {
         capture_cv_.wait(lock);
       }
@@ -196,6 +254,12 @@ private:
       }
     }
 
+    // No capture is waiting; wake on any change
+    wake_threshold_ = WakeThreshold<stamp_type>{};
+
+    // Captured data may have been removed
+    CaptorInterfaceType::publish_queue_metadata();
+
     if (capturing_)
     {
       // Return state set in capture loop if not aborted externally
@@ -217,7 +281,37 @@ private:
   locate_impl(CaptureRangeT&& range, const std::chrono::time_point<ClockT, DurationT> timeout)
   {
     LockableT lock{capture_mutex_};
+    end_lease();
+    return locate_and_wait(lock, std::forward<CaptureRangeT>(range), timeout);
+  }
 
+  /**
+   * @copydoc CaptorInterface::capture_view
+   */
+  template <typename CaptureRangeT, typename ClockT, typename DurationT>
+  inline std::tuple<State, CaptureView<Captor>>
+  capture_view_impl(CaptureRangeT&& range, const std::chrono::time_point<ClockT, DurationT> timeout)
+  {
+    LockableT lock{capture_mutex_};
+    end_lease();
+
+    State state{State::ABORT};
+    ExtractionRange extraction_range{};
+    std::tie(state, extraction_range) = locate_and_wait(lock, range, timeout);
+
+    // Extraction is applied immediately when there is nothing to view
+    auto state_and_view = CaptorInterfaceType::lease(state, extraction_range, range, extract_fn());
+    CaptorInterfaceType::publish_queue_metadata();
+    return state_and_view;
+  }
+
+  /**
+   * @brief Waits for ready state and finds element range to extract, under \p lock
+   */
+  template <typename CaptureRangeT, typename ClockT, typename DurationT>
+  inline std::tuple<State, ExtractionRange>
+  locate_and_wait(LockableT& lock, CaptureRangeT&& range, const std::chrono::time_point<ClockT, DurationT> timeout)
+  {
     // Wait for data and attempt capture when data is available
     State state{State::ABORT};
     ExtractionRange extraction_range{};
@@ -231,7 +325,16 @@ private:
       {
         break;
       }
-      else if (std::chrono::time_point<ClockT, DurationT>::max() == timeout)
+      else if (std::chrono::time_point<ClockT, DurationT>::min() == timeout)
+      {
+        // Do not wait at all
+        state = State::TIMEOUT;
+        break;
+      }
+
+      // Wait until data which could change capture state arrives
+      wake_threshold_ = derived()->wake_threshold_policy_impl(range);
+      if (std::chrono::time_point<ClockT, DurationT>::max() == timeout)
       {
         capture_cv_.wait(lock);
       }
@@ -242,6 +345,9 @@ private:
       }
     }
 
+    // No capture is waiting; wake on any change
+    wake_threshold_ = WakeThreshold<stamp_type>{};
+
     if (capturing_)
     {
       // Return state set in capture loop if not aborted externally
@@ -255,6 +361,101 @@ private:
     }
   }
 
+  /**
+   * @copydoc CaptorInterface::defer_lock
+   */
+  inline std::unique_lock<MutexType> defer_lock_impl()
+  {
+    return std::unique_lock<MutexType>{capture_mutex_, std::defer_lock};
+  }
+
+  /**
+   * @copydoc CaptorInterface::locate_locked
+   */
+  template <typename CaptureRangeT> inline std::tuple<State, ExtractionRange> locate_locked_impl(CaptureRangeT&& range)
+  {
+    end_lease();
+
+    if (!capturing_)
+    {
+      // Make sure capturing flag is reset under lock before next capture attempt
+      capturing_ = true;
+      return std::make_tuple(State::ABORT, ExtractionRange{});
+    }
+    return derived()->locate_policy_impl(std::forward<CaptureRangeT>(range));
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_size_locked
+   */
+  inline size_type extract_size_locked_impl(const ExtractionRange& extraction_range) const
+  {
+    return derived()->extract_size_policy_impl(extraction_range);
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_locked
+   */
+  template <typename OutputDispatchIteratorT>
+  inline void extract_locked_impl(
+    OutputDispatchIteratorT& output,
+    const ExtractionRange& extraction_range,
+    const CaptureRange<stamp_type>& range,
+    const State sync_state)
+  {
+    derived()->extract_policy_impl(output, extraction_range, range);
+    CaptorInterfaceType::queue_monitor_.update(CaptorInterfaceType::queue_, range, sync_state);
+    CaptorInterfaceType::publish_queue_metadata();
+  }
+
+  /**
+   * @brief Releases lease held by CaptureView with \p lease_id, if it is still held
+   */
+  inline void release_lease_impl(const std::size_t lease_id)
+  {
+    {
+      LockableT lock{capture_mutex_};
+      if (!CaptorInterfaceType::is_leased(lease_id) or !end_lease())
+      {
+        return;
+      }
+    }
+
+    // Notify that data has changed
+    capture_cv_.notify_one();
+  }
+
+  /**
+   * @brief Returns callable which runs extraction specific to this captor, for use with leases
+   */
+  inline auto extract_fn()
+  {
+    return [this](
+             detail::DiscardOutputIterator& output,
+             const ExtractionRange& extraction_range,
+             const CaptureRange<stamp_type>& range) {
+      derived()->extract_policy_impl(output, extraction_range, range);
+    };
+  }
+
+  /**
+   * @brief Releases current lease, if any, applying deferred extraction and queue changes
+   *
+   * @note Must be called under lock
+   */
+  inline bool end_lease()
+  {
+    if (CaptorInterfaceType::end_lease(
+          extract_fn(),
+          [this](const stamp_type& t_abort) { derived()->abort_policy_impl(t_abort); },
+          [this] { derived()->reset_policy_impl(); }))
+    {
+      CaptorInterfaceType::publish_queue_metadata();
+      return true;
+    }
+    return false;
+  }
+
   /**
    * @copydoc CaptorInterface::extract_impl
    */
@@ -266,6 +467,7 @@ private:
   {
     LockableT lock{capture_mutex_};
     derived()->extract_policy_impl(output, extraction_range, range);
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /**
@@ -273,7 +475,7 @@ private:
    */
   template <typename InpectCallbackT> inline void inspect_impl(InpectCallbackT&& inspect_dispatch_cb) const
   {
-    LockableT lock{capture_mutex_};
+    ReadLockType lock{capture_mutex_};
 
     for (const auto& dispatch : CaptorInterfaceType::queue_)
     {
@@ -289,6 +491,7 @@ private:
     LockableT lock{capture_mutex_};
     CaptorInterfaceType::queue_monitor_.update(
       CaptorInterfaceType::queue_, std::forward<CaptureRangeT>(range), sync_state);
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /**
@@ -305,26 +508,64 @@ private:
    */
   inline size_type get_capacity_impl() const
   {
-    LockableT lock{capture_mutex_};
+    ReadLockType lock{capture_mutex_};
     return CaptorInterfaceType::capacity_;
   }
 
+  /**
+   * @copydoc CaptorInterface::set_admission_policy
+   */
+  inline void set_admission_policy_impl(const AdmissionPolicy admission_policy)
+  {
+    LockableT lock{capture_mutex_};
+    CaptorInterfaceType::admission_policy_ = admission_policy;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_admission_policy
+   */
+  inline AdmissionPolicy get_admission_policy_impl() const
+  {
+    ReadLockType lock{capture_mutex_};
+    return CaptorInterfaceType::admission_policy_;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_admission_stats
+   */
+  inline AdmissionStats get_admission_stats_impl() const
+  {
+    ReadLockType lock{capture_mutex_};
+    return CaptorInterfaceType::admission_stats_;
+  }
+
   /**
    * @copydoc CaptorInterface::get_available_stamp_range
    */
   inline CaptureRange<stamp_type> get_available_stamp_range_impl() const
   {
-    LockableT lock{capture_mutex_};
-    return queue_.empty() ? CaptureRange<stamp_type>{}
-                          : CaptureRange<stamp_type>{queue_.oldest_stamp(), queue_.newest_stamp()};
+    // Lock-free; does not contend with inject or capture
+    return CaptorInterfaceType::load_queue_metadata().range;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_insertion_stats
+   */
+  inline InsertionStats get_insertion_stats_impl() const
+  {
+    ReadLockType lock{capture_mutex_};
+    return queue_.get_insertion_stats();
   }
 
   /// Mutex to protect queue and captures
-  mutable std::mutex capture_mutex_;
+  mutable MutexType capture_mutex_;
 
   /// Flag used to indicate that capture loop should continue
   volatile bool capturing_ = true;
 
+  /// Queue state which must be reached before new data is worth waking a waiting capture
+  WakeThreshold<stamp_type> wake_threshold_;
+
   /**
    * @brief Condition variable used to wait for data
    *
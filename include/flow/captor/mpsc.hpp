@@ -0,0 +1,30 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_CAPTURE_CAPTOR_MPSC_H
+#define FLOW_CAPTURE_CAPTOR_MPSC_H
+
+// C++ Standard Library
+#include <cstddef>
+
+// Flow
+#include <flow/captor/lane.hpp>
+#include <flow/utility/mpsc_ring.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Stand-in type used to signify that captors are fed by several producer threads, and polled for capture
+ *
+ * <code>Captor::inject</code> pushes new data into a lock-free multi-producer/single-consumer ring. Producers may
+ * inject concurrently, in any stamp order; data is merged into the captor queue in stamp order when drained.
+ *
+ * @copydetails InjectionLane
+ */
+template <std::size_t LaneCapacity = 1024UL> using MPSCLane = InjectionLane<MPSCRing, LaneCapacity>;
+
+}  // namespace flow
+
+#endif  // FLOW_CAPTURE_CAPTOR_MPSC_H
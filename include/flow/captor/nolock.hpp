@@ -62,6 +62,12 @@ private:
    */
   inline void reset_impl()
   {
+    if (CaptorInterfaceType::is_leased())
+    {
+      CaptorInterfaceType::defer(CaptorInterfaceType::DeferredOperation::RESET);
+      return;
+    }
+
     // Run reset behavior specific to this captor
     derived()->reset_policy_impl();
 
@@ -74,6 +80,12 @@ private:
    */
   inline void abort_impl(const stamp_type& t_abort)
   {
+    if (CaptorInterfaceType::is_leased())
+    {
+      CaptorInterfaceType::defer(CaptorInterfaceType::DeferredOperation::ABORT, t_abort);
+      return;
+    }
+
     // Run abort behavior specific to this captor
     derived()->abort_policy_impl(t_abort);
   }
@@ -97,8 +109,7 @@ private:
   template <typename FirstForwardDispatchIteratorT, typename LastForwardDispatchIteratorT>
   inline void insert_impl(FirstForwardDispatchIteratorT first, LastForwardDispatchIteratorT last)
   {
-    std::for_each(
-      first, last, [this](const DispatchType& dispatch) { CaptorInterfaceType::insert_and_limit(dispatch); });
+    CaptorInterfaceType::merge_and_limit(CaptorInterfaceType::sort_by_stamp(first, last));
   }
 
   /**
@@ -106,6 +117,12 @@ private:
    */
   inline void remove_impl(const stamp_type& t_remove)
   {
+    if (CaptorInterfaceType::is_leased())
+    {
+      CaptorInterfaceType::defer(CaptorInterfaceType::DeferredOperation::REMOVE, t_remove);
+      return;
+    }
+
     // Remove all data before this time
     CaptorInterfaceType::queue_.remove_before(t_remove);
   }
@@ -120,6 +137,24 @@ private:
    */
   inline size_type get_capacity_impl() const { return CaptorInterfaceType::capacity_; }
 
+  /**
+   * @copydoc CaptorInterface::set_admission_policy
+   */
+  inline void set_admission_policy_impl(const AdmissionPolicy admission_policy)
+  {
+    CaptorInterfaceType::admission_policy_ = admission_policy;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_admission_policy
+   */
+  inline AdmissionPolicy get_admission_policy_impl() const { return CaptorInterfaceType::admission_policy_; }
+
+  /**
+   * @copydoc CaptorInterface::get_admission_stats
+   */
+  inline AdmissionStats get_admission_stats_impl() const { return CaptorInterfaceType::admission_stats_; }
+
   /**
    * @copydoc CaptorInterface::get_available_stamp_range
    */
@@ -129,12 +164,18 @@ private:
                           : CaptureRange<stamp_type>{queue_.oldest_stamp(), queue_.newest_stamp()};
   }
 
+  /**
+   * @copydoc CaptorInterface::get_insertion_stats
+   */
+  inline InsertionStats get_insertion_stats_impl() const { return queue_.get_insertion_stats(); }
+
   /**
    * @copydoc CaptorInterface::capture
    */
   template <typename OutputDispatchIteratorT, typename CaptureRangeT>
   inline State capture_impl(OutputDispatchIteratorT& output, CaptureRangeT&& range)
   {
+    end_lease();
     return derived()->capture_policy_impl(output, std::forward<CaptureRangeT>(range));
   }
 
@@ -143,9 +184,25 @@ private:
    */
   template <typename CaptureRangeT> std::tuple<State, ExtractionRange> locate_impl(CaptureRangeT&& range)
   {
+    end_lease();
     return derived()->locate_policy_impl(std::forward<CaptureRangeT>(range));
   }
 
+  /**
+   * @copydoc CaptorInterface::capture_view
+   */
+  template <typename CaptureRangeT>
+  inline std::tuple<State, CaptureView<Captor>> capture_view_impl(CaptureRangeT&& range)
+  {
+    end_lease();
+
+    State state{State::ABORT};
+    ExtractionRange extraction_range{};
+    std::tie(state, extraction_range) = derived()->locate_policy_impl(range);
+
+    return CaptorInterfaceType::lease(state, extraction_range, range, extract_fn());
+  }
+
   /**
    * @copydoc CaptorInterface::extract_impl
    */
@@ -158,6 +215,42 @@ private:
     derived()->extract_policy_impl(output, extraction_range, range);
   }
 
+  /**
+   * @copydoc CaptorInterface::defer_lock
+   */
+  inline detail::NullLock defer_lock_impl() { return detail::NullLock{}; }
+
+  /**
+   * @copydoc CaptorInterface::locate_locked
+   */
+  template <typename CaptureRangeT> inline std::tuple<State, ExtractionRange> locate_locked_impl(CaptureRangeT&& range)
+  {
+    end_lease();
+    return derived()->locate_policy_impl(std::forward<CaptureRangeT>(range));
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_size_locked
+   */
+  inline size_type extract_size_locked_impl(const ExtractionRange& extraction_range) const
+  {
+    return derived()->extract_size_policy_impl(extraction_range);
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_locked
+   */
+  template <typename OutputDispatchIteratorT>
+  inline void extract_locked_impl(
+    OutputDispatchIteratorT& output,
+    const ExtractionRange& extraction_range,
+    const CaptureRange<stamp_type>& range,
+    const State sync_state)
+  {
+    derived()->extract_policy_impl(output, extraction_range, range);
+    CaptorInterfaceType::queue_monitor_.update(CaptorInterfaceType::queue_, range, sync_state);
+  }
+
   /**
    * @copydoc CaptorInterface::capture
    */
@@ -178,6 +271,41 @@ private:
       CaptorInterfaceType::queue_, std::forward<CaptureRangeT>(range), sync_state);
   }
 
+  /**
+   * @brief Releases lease held by CaptureView with \p lease_id, if it is still held
+   */
+  inline void release_lease_impl(const std::size_t lease_id)
+  {
+    if (CaptorInterfaceType::is_leased(lease_id))
+    {
+      end_lease();
+    }
+  }
+
+  /**
+   * @brief Returns callable which runs extraction specific to this captor, for use with leases
+   */
+  inline auto extract_fn()
+  {
+    return [this](
+             detail::DiscardOutputIterator& output,
+             const ExtractionRange& extraction_range,
+             const CaptureRange<stamp_type>& range) {
+      derived()->extract_policy_impl(output, extraction_range, range);
+    };
+  }
+
+  /**
+   * @brief Releases current lease, if any, applying deferred extraction and queue changes
+   */
+  inline bool end_lease()
+  {
+    return CaptorInterfaceType::end_lease(
+      extract_fn(),
+      [this](const stamp_type& t_abort) { derived()->abort_policy_impl(t_abort); },
+      [this] { derived()->reset_policy_impl(); });
+  }
+
   using CaptorInterfaceType = CaptorInterface<Captor<CaptorT, NoLock, QueueMonitorT>>;
   friend CaptorInterfaceType;
 
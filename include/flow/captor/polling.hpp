@@ -13,6 +13,7 @@
 
 // Flow
 #include <flow/captor.hpp>
+#include <flow/utility/shared_lock.hpp>
 
 namespace flow
 {
@@ -25,7 +26,10 @@ namespace flow
  * This allows for polling with the <code>Captor::capture</code> method
  * \n
  * See https://en.cppreference.com/w/cpp/named_req/TimedLockable for more information on
- * <code>BasicLockableT</code> criteria
+ * <code>BasicLockableT</code> criteria. The queue is protected by a <code>BasicLockableT::mutex_type</code>;
+ * use <code>std::lock_guard<flow::AdaptiveMutex></code> to spin briefly rather than park on short critical sections,
+ * or <code>std::lock_guard<std::shared_timed_mutex></code> so that read-only operations, such as
+ * <code>Captor::inspect</code>, do not serialize with each other
  */
 template <typename BasicLockableT = std::lock_guard<std::mutex>> struct PollingLock
 {
@@ -74,6 +78,12 @@ public:
   ~Captor() = default;
 
 private:
+  /// Mutex type locked by <code>BasicLockableT</code>
+  using MutexType = typename BasicLockableT::mutex_type;
+
+  /// Lock used by read-only operations; shared when <code>MutexType</code> is <code>SharedLockable</code>
+  using ReadLockType = ReadLock<MutexType, BasicLockableT>;
+
   /**
    * @copydoc CaptorInterface::reset
    */
@@ -86,6 +96,7 @@ private:
 
     // Remove all data
     CaptorInterfaceType::queue_.clear();
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /**
@@ -97,6 +108,7 @@ private:
 
     // Run abort behavior specific to this captor
     derived()->abort_policy_impl(t_abort);
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /**
@@ -104,8 +116,8 @@ private:
    */
   inline size_type size_impl() const
   {
-    BasicLockableT lock{queue_mutex_};
-    return CaptorInterfaceType::queue_.size();
+    // Lock-free; does not contend with inject or capture
+    return CaptorInterfaceType::load_queue_metadata().size;
   }
 
   /**
@@ -113,8 +125,12 @@ private:
    */
   template <typename... DispatchConstructorArgTs> inline void inject_impl(DispatchConstructorArgTs&&... dispatch_args)
   {
+    // Build new data before locking, so that the critical section only moves it into place
+    DispatchType dispatch{std::forward<DispatchConstructorArgTs>(dispatch_args)...};
+
     BasicLockableT lock{queue_mutex_};
-    CaptorInterfaceType::insert_and_limit(std::forward<DispatchConstructorArgTs>(dispatch_args)...);
+    CaptorInterfaceType::insert_and_limit(std::move(dispatch));
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /**
@@ -123,9 +139,12 @@ private:
   template <typename FirstForwardDispatchIteratorT, typename LastForwardDispatchIteratorT>
   inline void insert_impl(FirstForwardDispatchIteratorT first, LastForwardDispatchIteratorT last)
   {
+    // Sort new data before locking
+    auto sorted_dispatches = CaptorInterfaceType::sort_by_stamp(first, last);
+
     BasicLockableT lock{queue_mutex_};
-    std::for_each(
-      first, last, [this](const DispatchType& dispatch) { CaptorInterfaceType::insert_and_limit(dispatch); });
+    CaptorInterfaceType::merge_and_limit(std::move(sorted_dispatches));
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /**
@@ -137,6 +156,7 @@ private:
 
     // Remove all data before this time
     CaptorInterfaceType::queue_.remove_before(t_remove);
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /**
@@ -153,18 +173,53 @@ private:
    */
   inline size_type get_capacity_impl() const
   {
-    BasicLockableT lock{queue_mutex_};
+    ReadLockType lock{queue_mutex_};
     return CaptorInterfaceType::capacity_;
   }
 
+  /**
+   * @copydoc CaptorInterface::set_admission_policy
+   */
+  inline void set_admission_policy_impl(const AdmissionPolicy admission_policy)
+  {
+    BasicLockableT lock{queue_mutex_};
+    CaptorInterfaceType::admission_policy_ = admission_policy;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_admission_policy
+   */
+  inline AdmissionPolicy get_admission_policy_impl() const
+  {
+    ReadLockType lock{queue_mutex_};
+    return CaptorInterfaceType::admission_policy_;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_admission_stats
+   */
+  inline AdmissionStats get_admission_stats_impl() const
+  {
+    ReadLockType lock{queue_mutex_};
+    return CaptorInterfaceType::admission_stats_;
+  }
+
   /**
    * @copydoc CaptorInterface::get_available_stamp_range
    */
   inline CaptureRange<stamp_type> get_available_stamp_range_impl() const
   {
-    BasicLockableT lock{queue_mutex_};
-    return queue_.empty() ? CaptureRange<stamp_type>{}
-                          : CaptureRange<stamp_type>{queue_.oldest_stamp(), queue_.newest_stamp()};
+    // Lock-free; does not contend with inject or capture
+    return CaptorInterfaceType::load_queue_metadata().range;
+  }
+
+  /**
+   * @copydoc CaptorInterface::get_insertion_stats
+   */
+  inline InsertionStats get_insertion_stats_impl() const
+  {
+    ReadLockType lock{queue_mutex_};
+    return queue_.get_insertion_stats();
   }
 
   /**
@@ -174,7 +229,15 @@ private:
   inline State capture_impl(OutputDispatchIteratorT& output, CaptureRangeT&& range)
   {
     BasicLockableT lock{queue_mutex_};
-    return derived()->capture_policy_impl(output, std::forward<CaptureRangeT>(range));
+    const auto size_before_capture = CaptorInterfaceType::queue_.size();
+    const State state = derived()->capture_policy_impl(output, std::forward<CaptureRangeT>(range));
+
+    // Capture only ever removes data; skip publishing when polling left the queue as it was
+    if (CaptorInterfaceType::queue_.size() != size_before_capture)
+    {
+      CaptorInterfaceType::publish_queue_metadata();
+    }
+    return state;
   }
 
   /**
@@ -197,6 +260,46 @@ private:
   {
     BasicLockableT lock{queue_mutex_};
     derived()->extract_policy_impl(output, extraction_range, range);
+    CaptorInterfaceType::publish_queue_metadata();
+  }
+
+  /**
+   * @copydoc CaptorInterface::defer_lock
+   */
+  inline std::unique_lock<MutexType> defer_lock_impl()
+  {
+    return std::unique_lock<MutexType>{queue_mutex_, std::defer_lock};
+  }
+
+  /**
+   * @copydoc CaptorInterface::locate_locked
+   */
+  template <typename CaptureRangeT> inline std::tuple<State, ExtractionRange> locate_locked_impl(CaptureRangeT&& range)
+  {
+    return derived()->locate_policy_impl(std::forward<CaptureRangeT>(range));
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_size_locked
+   */
+  inline size_type extract_size_locked_impl(const ExtractionRange& extraction_range) const
+  {
+    return derived()->extract_size_policy_impl(extraction_range);
+  }
+
+  /**
+   * @copydoc CaptorInterface::extract_locked
+   */
+  template <typename OutputDispatchIteratorT>
+  inline void extract_locked_impl(
+    OutputDispatchIteratorT& output,
+    const ExtractionRange& extraction_range,
+    const CaptureRange<stamp_type>& range,
+    const State sync_state)
+  {
+    derived()->extract_policy_impl(output, extraction_range, range);
+    CaptorInterfaceType::queue_monitor_.update(CaptorInterfaceType::queue_, range, sync_state);
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /**
@@ -204,7 +307,7 @@ private:
    */
   template <typename InpectCallbackT> void inspect_impl(InpectCallbackT&& inspect_dispatch_cb) const
   {
-    BasicLockableT lock{queue_mutex_};
+    ReadLockType lock{queue_mutex_};
     for (const auto& dispatch : CaptorInterfaceType::queue_)
     {
       inspect_dispatch_cb(dispatch);
@@ -219,10 +322,11 @@ private:
     BasicLockableT lock{queue_mutex_};
     CaptorInterfaceType::queue_monitor_.update(
       CaptorInterfaceType::queue_, std::forward<CaptureRangeT>(range), sync_state);
+    CaptorInterfaceType::publish_queue_metadata();
   }
 
   /// Mutex to protect queue ONLY
-  mutable std::mutex queue_mutex_;
+  mutable MutexType queue_mutex_;
 
   using CaptorInterfaceType = CaptorInterface<Captor<CaptorT, PollingLock<BasicLockableT>, QueueMonitorT>>;
   friend CaptorInterfaceType;
@@ -0,0 +1,31 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_CAPTURE_CAPTOR_SPSC_H
+#define FLOW_CAPTURE_CAPTOR_SPSC_H
+
+// C++ Standard Library
+#include <cstddef>
+
+// Flow
+#include <flow/captor/lane.hpp>
+#include <flow/utility/spsc_ring.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Stand-in type used to signify that captors are fed by a single producer thread, and polled for capture
+ *
+ * <code>Captor::inject</code> pushes new data into a wait-free single-producer/single-consumer ring
+ *
+ * @copydetails InjectionLane
+ *
+ * @warning Only one thread may inject data at a time
+ */
+template <std::size_t LaneCapacity = 1024UL> using SPSCLane = InjectionLane<SPSCRing, LaneCapacity>;
+
+}  // namespace flow
+
+#endif  // FLOW_CAPTURE_CAPTOR_SPSC_H
@@ -0,0 +1,358 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_CONTAINER_RECYCLING_LIST_HPP
+#define FLOW_CONTAINER_RECYCLING_LIST_HPP
+
+// C++ Standard Library
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace flow
+{
+
+/**
+ * @brief Doubly-linked, node-based dispatch container which recycles its nodes
+ *
+ * Fulfills the <code>ContainerT</code> requirements of DispatchQueue. Nodes of removed elements are kept on a
+ * free-list owned by the container, and are re-used by later insertions, so a queue which stays under its
+ * high-water mark performs no allocations once it has warmed up (or after <code>reserve</code>). Adding an element
+ * only links a node into place, independent of queue size and position.
+ * \n
+ * Whole ranges of elements may be moved between lists with <code>splice</code>, which relinks nodes rather than
+ * moving elements. Captors which extract a prefix of their queue (e.g. <code>follower::AnyBefore</code> and
+ * <code>driver::Chunk</code>) splice captured data into a caller-owned list when given a
+ * <code>SpliceInserter</code> for that list as their output. Spliced nodes are recycled by the list which receives
+ * them, so a long-lived receiving list should call <code>shrink_to_fit</code> after it is cleared to bound its
+ * memory use.
+ *
+ * @tparam T  element type
+ * @tparam AllocatorT  allocator used for nodes; all lists which splice with each other must use equal allocators
+ */
+template <typename T, typename AllocatorT = std::allocator<T>> class RecyclingList
+{
+  /// Iterator implementation
+  template <typename ValueT> class Iterator;
+
+  /// Links shared by element nodes and the list sentinel
+  struct Link
+  {
+    Link* prev;
+    Link* next;
+  };
+
+  /// Element node
+  struct Node : Link
+  {
+    std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+
+    inline T* value() { return reinterpret_cast<T*>(&storage); }
+  };
+
+  /// Node allocator type
+  using NodeAllocatorType = typename std::allocator_traits<AllocatorT>::template rebind_alloc<Node>;
+
+public:
+  /// Element type
+  using value_type = T;
+
+  /// Allocator type
+  using allocator_type = AllocatorT;
+
+  /// Integer size type
+  using size_type = std::size_t;
+
+  /// Iterator distance type
+  using difference_type = std::ptrdiff_t;
+
+  /// Mutable element reference type
+  using reference = value_type&;
+
+  /// Immutable element reference type
+  using const_reference = const value_type&;
+
+  /// Mutable element iterator type
+  using iterator = Iterator<value_type>;
+
+  /// Immutable element iterator type
+  using const_iterator = Iterator<const value_type>;
+
+  /// Mutable reverse element iterator type
+  using reverse_iterator = std::reverse_iterator<iterator>;
+
+  /// Immutable reverse element iterator type
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  /**
+   * @brief Default constructor
+   */
+  RecyclingList() : RecyclingList{AllocatorT{}} {}
+
+  /**
+   * @brief Allocator constructor
+   */
+  explicit RecyclingList(const AllocatorT& allocator);
+
+  /**
+   * @brief Copy constructor
+   *
+   * @note Copies elements only; free nodes are not copied
+   */
+  RecyclingList(const RecyclingList& other);
+
+  /**
+   * @brief Move constructor
+   *
+   * @note Takes all elements and free nodes from \p other
+   */
+  RecyclingList(RecyclingList&& other);
+
+  /**
+   * @brief Destructor
+   */
+  ~RecyclingList();
+
+  /**
+   * @brief Copy assignment operator
+   */
+  RecyclingList& operator=(const RecyclingList& other);
+
+  /**
+   * @brief Move assignment operator
+   */
+  RecyclingList& operator=(RecyclingList&& other);
+
+  /**
+   * @brief Returns the number of elements in the list
+   */
+  inline size_type size() const { return size_; }
+
+  /**
+   * @brief Returns the number of elements which can be held before a node is allocated
+   */
+  inline size_type capacity() const { return size_ + free_size_; }
+
+  /**
+   * @brief Checks if list holds no elements
+   */
+  inline bool empty() const { return size_ == 0UL; }
+
+  /**
+   * @brief Ensures that the list can hold at least \p capacity elements without allocating
+   */
+  inline void reserve(const size_type capacity);
+
+  /**
+   * @brief Releases all free nodes
+   */
+  inline void shrink_to_fit();
+
+  /**
+   * @brief Returns first element
+   * @warning Undefined behavior when <code>empty() == true</code>
+   */
+  inline reference front() { return *begin(); }
+
+  /**
+   * @copydoc RecyclingList::front
+   */
+  inline const_reference front() const { return *begin(); }
+
+  /**
+   * @brief Returns last element
+   * @warning Undefined behavior when <code>empty() == true</code>
+   */
+  inline reference back() { return *std::prev(end()); }
+
+  /**
+   * @copydoc RecyclingList::back
+   */
+  inline const_reference back() const { return *std::prev(end()); }
+
+  inline iterator begin() { return iterator{sentinel_.next}; }
+  inline iterator end() { return iterator{&sentinel_}; }
+  inline const_iterator begin() const { return cbegin(); }
+  inline const_iterator end() const { return cend(); }
+  inline const_iterator cbegin() const { return const_iterator{sentinel_.next}; }
+  inline const_iterator cend() const { return const_iterator{const_cast<Link*>(&sentinel_)}; }
+
+  inline reverse_iterator rbegin() { return reverse_iterator{end()}; }
+  inline reverse_iterator rend() { return reverse_iterator{begin()}; }
+  inline const_reverse_iterator rbegin() const { return crbegin(); }
+  inline const_reverse_iterator rend() const { return crend(); }
+  inline const_reverse_iterator crbegin() const { return const_reverse_iterator{cend()}; }
+  inline const_reverse_iterator crend() const { return const_reverse_iterator{cbegin()}; }
+
+  /**
+   * @brief Constructs an element before the first element
+   */
+  template <typename... ArgTs> inline reference emplace_front(ArgTs&&... args)
+  {
+    return *emplace(cbegin(), std::forward<ArgTs>(args)...);
+  }
+
+  /**
+   * @brief Constructs an element after the last element
+   */
+  template <typename... ArgTs> inline reference emplace_back(ArgTs&&... args)
+  {
+    return *emplace(cend(), std::forward<ArgTs>(args)...);
+  }
+
+  /**
+   * @brief Constructs an element before \p pos
+   *
+   * Takes a free node when one is available; otherwise, allocates a new node
+   */
+  template <typename... ArgTs> inline iterator emplace(const_iterator pos, ArgTs&&... args);
+
+  /**
+   * @brief Copies an element after the last element
+   */
+  inline void push_back(const value_type& value) { emplace_back(value); }
+
+  /**
+   * @brief Moves an element after the last element
+   */
+  inline void push_back(value_type&& value) { emplace_back(std::move(value)); }
+
+  /**
+   * @brief Removes first element
+   * @warning Undefined behavior when <code>empty() == true</code>
+   */
+  inline void pop_front() { erase(cbegin()); }
+
+  /**
+   * @brief Removes last element
+   * @warning Undefined behavior when <code>empty() == true</code>
+   */
+  inline void pop_back() { erase(std::prev(cend())); }
+
+  /**
+   * @brief Removes elements in range <code>[first, last)</code>, keeping their nodes for re-use
+   *
+   * @return iterator following the last removed element
+   */
+  inline iterator erase(const_iterator first, const_iterator last);
+
+  /**
+   * @brief Removes element at \p pos, keeping its node for re-use
+   *
+   * @return iterator following the removed element
+   */
+  inline iterator erase(const_iterator pos) { return erase(pos, std::next(pos)); }
+
+  /**
+   * @brief Removes all elements, keeping their nodes for re-use
+   */
+  inline void clear() { erase(cbegin(), cend()); }
+
+  /**
+   * @brief Moves elements in range <code>[first, last)</code> of \p other before \p pos
+   *
+   * Nodes are relinked; elements are neither copied nor moved, and iterators to them remain valid
+   *
+   * @param pos  position in this list before which elements are placed
+   * @param other  list which holds elements to move; may be this list, if \p pos is not in <code>[first, last)</code>
+   * @param first  first element to move
+   * @param last  one past last element to move
+   */
+  inline void splice(const_iterator pos, RecyclingList& other, const_iterator first, const_iterator last);
+
+  /**
+   * @brief Moves all elements of \p other before \p pos
+   */
+  inline void splice(const_iterator pos, RecyclingList& other) { splice(pos, other, other.cbegin(), other.cend()); }
+
+  /**
+   * @brief Swaps contents, including free nodes, with another list
+   */
+  inline void swap(RecyclingList& other);
+
+  /**
+   * @brief Returns allocator used for nodes
+   */
+  inline allocator_type get_allocator() const { return allocator_type{allocator_}; }
+
+private:
+  /// Takes a free node, or allocates one if none are free
+  inline Node* acquire();
+
+  /// Adds a node, with no element, to the free-list
+  inline void recycle(Node* const node);
+
+  /// Links \p node before \p pos
+  static inline void link_before(Link* const pos, Link* const node);
+
+  /// Releases all elements and nodes
+  inline void release();
+
+  /// Node allocator
+  NodeAllocatorType allocator_;
+
+  /// List head/tail sentinel; circular, such that an empty list links to itself
+  Link sentinel_;
+
+  /// Number of elements
+  size_type size_ = 0UL;
+
+  /// Singly-linked (through <code>Link::next</code>) list of nodes with no element
+  Link* free_ = nullptr;
+
+  /// Number of free nodes
+  size_type free_size_ = 0UL;
+};
+
+
+/**
+ * @brief RecyclingList bidirectional iterator
+ *
+ * Iterators remain valid until the element they refer to is removed
+ */
+template <typename T, typename AllocatorT> template <typename ValueT> class RecyclingList<T, AllocatorT>::Iterator
+{
+public:
+  using iterator_category = std::bidirectional_iterator_tag;
+  using value_type = std::remove_const_t<ValueT>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = ValueT*;
+  using reference = ValueT&;
+
+  Iterator() = default;
+
+  explicit Iterator(Link* const link) : link_{link} {}
+
+  /// Conversion from mutable to immutable iterator
+  template <typename OtherValueT, typename = std::enable_if_t<std::is_convertible<OtherValueT*, ValueT*>::value>>
+  Iterator(const Iterator<OtherValueT>& other) : link_{other.link_}
+  {}
+
+  inline reference operator*() const { return *static_cast<Node*>(link_)->value(); }
+  inline pointer operator->() const { return static_cast<Node*>(link_)->value(); }
+
+  inline Iterator& operator++() { return link_ = link_->next, *this; }
+  inline Iterator& operator--() { return link_ = link_->prev, *this; }
+  inline Iterator operator++(int) { return Iterator{std::exchange(link_, link_->next)}; }
+  inline Iterator operator--(int) { return Iterator{std::exchange(link_, link_->prev)}; }
+
+  inline bool operator==(const Iterator& other) const { return link_ == other.link_; }
+  inline bool operator!=(const Iterator& other) const { return link_ != other.link_; }
+
+private:
+  template <typename OtherValueT> friend class Iterator;
+  friend class RecyclingList;
+
+  /// Associated node, or list sentinel
+  Link* link_ = nullptr;
+};
+
+}  // namespace flow
+
+// Flow (implementation)
+#include <flow/impl/container/recycling_list.hpp>
+
+#endif  // FLOW_CONTAINER_RECYCLING_LIST_HPP
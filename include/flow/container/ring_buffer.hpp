@@ -0,0 +1,419 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_CONTAINER_RING_BUFFER_HPP
+#define FLOW_CONTAINER_RING_BUFFER_HPP
+
+// C++ Standard Library
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+
+namespace flow
+{
+
+/**
+ * @brief Capacity template argument used to select a RingBuffer with a capacity specified at runtime
+ */
+static constexpr std::size_t RingBufferDynamicCapacity = 0UL;
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/// Uninitialized storage for a single ring buffer element
+template <typename T> using RingBufferSlot = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+/**
+ * @brief Fixed-capacity ring buffer storage, held in-place
+ */
+template <typename T, std::size_t N> class RingBufferStorage
+{
+public:
+  RingBufferStorage() = default;
+
+  explicit RingBufferStorage(const std::size_t capacity) {}
+
+  static constexpr std::size_t capacity() { return N; }
+
+  T* slot(const std::size_t index) { return reinterpret_cast<T*>(slots_ + index); }
+
+  const T* slot(const std::size_t index) const { return reinterpret_cast<const T*>(slots_ + index); }
+
+  static constexpr bool is_resizable() { return false; }
+
+private:
+  RingBufferSlot<T> slots_[N];
+};
+
+/**
+ * @brief Runtime-capacity ring buffer storage, held on the heap
+ */
+template <typename T> class RingBufferStorage<T, RingBufferDynamicCapacity>
+{
+public:
+  RingBufferStorage() = default;
+
+  explicit RingBufferStorage(const std::size_t capacity) :
+      slots_{capacity ? new RingBufferSlot<T>[capacity] : nullptr},
+      capacity_{capacity}
+  {}
+
+  std::size_t capacity() const { return capacity_; }
+
+  T* slot(const std::size_t index) { return reinterpret_cast<T*>(slots_.get() + index); }
+
+  const T* slot(const std::size_t index) const { return reinterpret_cast<const T*>(slots_.get() + index); }
+
+  static constexpr bool is_resizable() { return true; }
+
+  void swap(RingBufferStorage& other) noexcept
+  {
+    std::swap(slots_, other.slots_);
+    std::swap(capacity_, other.capacity_);
+  }
+
+private:
+  std::unique_ptr<RingBufferSlot<T>[]> slots_;
+  std::size_t capacity_ = 0UL;
+};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+
+/**
+ * @brief Contiguous, circular dispatch container
+ *
+ * Fulfills the <code>ContainerT</code> requirements of DispatchQueue. Elements are stored in a single block of
+ * memory which is re-used as elements are added and removed from either end, so a queue which stays under its
+ * capacity performs no allocations after its storage is first acquired. Out-of-order insertions with
+ * <code>emplace</code> shift elements on the shorter side of the insertion point.
+ * \n
+ * When \p N is non-zero, storage for \p N elements is held in-place and adding an element to a full buffer
+ * throws <code>std::length_error</code>. Pair this with a captor capacity of at most <code>N</code>; captors remove
+ * their oldest elements before inserting new data, so a full buffer is never overflowed. When \p N is
+ * <code>RingBufferDynamicCapacity</code>, storage is allocated on construction and grows (doubling) when a full
+ * buffer has an element added.
+ *
+ * @tparam T  element type
+ * @tparam N  fixed element capacity, or <code>RingBufferDynamicCapacity</code>
+ */
+template <typename T, std::size_t N = RingBufferDynamicCapacity>
+class RingBuffer : private detail::RingBufferStorage<T, N>
+{
+  /// Iterator implementation
+  template <typename BufferT, typename ValueT> class Iterator;
+
+public:
+  /// Element type
+  using value_type = T;
+
+  /// Integer size type
+  using size_type = std::size_t;
+
+  /// Iterator distance type
+  using difference_type = std::ptrdiff_t;
+
+  /// Mutable element reference type
+  using reference = value_type&;
+
+  /// Immutable element reference type
+  using const_reference = const value_type&;
+
+  /// Mutable element iterator type
+  using iterator = Iterator<RingBuffer, value_type>;
+
+  /// Immutable element iterator type
+  using const_iterator = Iterator<const RingBuffer, const value_type>;
+
+  /// Mutable reverse element iterator type
+  using reverse_iterator = std::reverse_iterator<iterator>;
+
+  /// Immutable reverse element iterator type
+  using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+  /**
+   * @brief Default constructor
+   *
+   * @note With <code>N == RingBufferDynamicCapacity</code>, no storage is allocated until the first insertion
+   */
+  RingBuffer() = default;
+
+  /**
+   * @brief Capacity constructor
+   *
+   * @param capacity  initial element capacity; ignored when \p N is non-zero
+   */
+  explicit RingBuffer(const size_type capacity);
+
+  /**
+   * @brief Copy constructor
+   */
+  RingBuffer(const RingBuffer& other);
+
+  /**
+   * @brief Move constructor
+   */
+  RingBuffer(RingBuffer&& other);
+
+  /**
+   * @brief Destructor
+   */
+  ~RingBuffer() { clear(); }
+
+  /**
+   * @brief Copy assignment operator
+   */
+  RingBuffer& operator=(const RingBuffer& other);
+
+  /**
+   * @brief Move assignment operator
+   */
+  RingBuffer& operator=(RingBuffer&& other);
+
+  /**
+   * @brief Returns the number of elements in the buffer
+   */
+  inline size_type size() const { return size_; }
+
+  /**
+   * @brief Returns the number of elements which can be held before the buffer is full
+   */
+  inline size_type capacity() const { return StorageType::capacity(); }
+
+  /**
+   * @brief Checks if buffer holds no elements
+   */
+  inline bool empty() const { return size_ == 0UL; }
+
+  /**
+   * @brief Checks if buffer holds <code>capacity()</code> elements
+   */
+  inline bool full() const { return size_ == StorageType::capacity(); }
+
+  /**
+   * @brief Ensures that the buffer can hold at least \p capacity elements without allocating
+   *
+   * @throws <code>std::length_error</code> if \p N is non-zero and <code>capacity > N</code>
+   */
+  inline void reserve(const size_type capacity);
+
+  /**
+   * @brief Accesses element at position \p pos, starting from the oldest element
+   */
+  inline reference operator[](const size_type pos) { return *element(pos); }
+
+  /**
+   * @copydoc RingBuffer::operator[]
+   */
+  inline const_reference operator[](const size_type pos) const { return *element(pos); }
+
+  /**
+   * @brief Returns first element
+   * @warning Undefined behavior when <code>empty() == true</code>
+   */
+  inline reference front() { return *element(0UL); }
+
+  /**
+   * @copydoc RingBuffer::front
+   */
+  inline const_reference front() const { return *element(0UL); }
+
+  /**
+   * @brief Returns last element
+   * @warning Undefined behavior when <code>empty() == true</code>
+   */
+  inline reference back() { return *element(size_ - 1UL); }
+
+  /**
+   * @copydoc RingBuffer::back
+   */
+  inline const_reference back() const { return *element(size_ - 1UL); }
+
+  inline iterator begin() { return iterator{this, 0}; }
+  inline iterator end() { return iterator{this, static_cast<difference_type>(size_)}; }
+  inline const_iterator begin() const { return cbegin(); }
+  inline const_iterator end() const { return cend(); }
+  inline const_iterator cbegin() const { return const_iterator{this, 0}; }
+  inline const_iterator cend() const { return const_iterator{this, static_cast<difference_type>(size_)}; }
+
+  inline reverse_iterator rbegin() { return reverse_iterator{end()}; }
+  inline reverse_iterator rend() { return reverse_iterator{begin()}; }
+  inline const_reverse_iterator rbegin() const { return crbegin(); }
+  inline const_reverse_iterator rend() const { return crend(); }
+  inline const_reverse_iterator crbegin() const { return const_reverse_iterator{cend()}; }
+  inline const_reverse_iterator crend() const { return const_reverse_iterator{cbegin()}; }
+
+  /**
+   * @brief Constructs an element, in place, before the first element
+   *
+   * @throws <code>std::length_error</code> if \p N is non-zero and buffer is full
+   */
+  template <typename... ArgTs> inline reference emplace_front(ArgTs&&... args);
+
+  /**
+   * @brief Constructs an element, in place, after the last element
+   *
+   * @throws <code>std::length_error</code> if \p N is non-zero and buffer is full
+   */
+  template <typename... ArgTs> inline reference emplace_back(ArgTs&&... args);
+
+  /**
+   * @brief Constructs an element before \p pos
+   *
+   * Elements on the shorter side of \p pos are shifted by one position
+   *
+   * @throws <code>std::length_error</code> if \p N is non-zero and buffer is full
+   */
+  template <typename... ArgTs> inline iterator emplace(const_iterator pos, ArgTs&&... args);
+
+  /**
+   * @brief Removes first element
+   * @warning Undefined behavior when <code>empty() == true</code>
+   */
+  inline void pop_front();
+
+  /**
+   * @brief Removes last element
+   * @warning Undefined behavior when <code>empty() == true</code>
+   */
+  inline void pop_back();
+
+  /**
+   * @brief Removes elements in range <code>[first, last)</code>
+   *
+   * Removing a range which starts at <code>begin()</code> or ends at <code>end()</code> only
+   * destroys the removed elements; otherwise, elements on the shorter side of the range are shifted
+   *
+   * @return iterator following the last removed element
+   */
+  inline iterator erase(const_iterator first, const_iterator last);
+
+  /**
+   * @brief Removes element at \p pos
+   *
+   * @return iterator following the removed element
+   */
+  inline iterator erase(const_iterator pos) { return erase(pos, std::next(pos)); }
+
+  /**
+   * @brief Removes all elements
+   *
+   * @note Does not release storage
+   */
+  inline void clear();
+
+  /**
+   * @brief Swaps contents with another buffer
+   */
+  inline void swap(RingBuffer& other);
+
+private:
+  using StorageType = detail::RingBufferStorage<T, N>;
+
+  /// Returns pointer to storage for element at logical position \p pos
+  inline T* element(const size_type pos) { return StorageType::slot(wrap(head_ + pos)); }
+
+  /// Returns pointer to storage for element at logical position \p pos
+  inline const T* element(const size_type pos) const { return StorageType::slot(wrap(head_ + pos)); }
+
+  /// Wraps a storage index which is less than <code>2 * capacity()</code>
+  inline size_type wrap(const size_type index) const
+  {
+    return (index < StorageType::capacity()) ? index : (index - StorageType::capacity());
+  }
+
+  /// Swaps heap-allocated storage
+  inline void swap_storage(RingBuffer& other, std::true_type /*resizable*/);
+
+  /// Swaps in-place storage element by element
+  inline void swap_storage(RingBuffer& other, std::false_type /*resizable*/);
+
+  /// Ensures that there is space for one more element
+  inline void make_room();
+
+  /// Moves all elements into storage with a new capacity
+  inline void reallocate(const size_type capacity);
+
+  /// Destroys elements at logical positions <code>[first, last)</code>
+  inline void destroy(const size_type first, const size_type last);
+
+  /// Storage index of first element
+  size_type head_ = 0UL;
+
+  /// Number of elements
+  size_type size_ = 0UL;
+};
+
+
+/**
+ * @brief RingBuffer random-access iterator
+ *
+ * Iterators are represented as a logical position within the buffer, and remain valid (refering to the same
+ * position) until the buffer is reallocated
+ */
+template <typename T, std::size_t N>
+template <typename BufferT, typename ValueT>
+class RingBuffer<T, N>::Iterator
+{
+public:
+  using iterator_category = std::random_access_iterator_tag;
+  using value_type = std::remove_const_t<ValueT>;
+  using difference_type = std::ptrdiff_t;
+  using pointer = ValueT*;
+  using reference = ValueT&;
+
+  Iterator() = default;
+
+  Iterator(BufferT* buffer, const difference_type pos) : buffer_{buffer}, pos_{pos} {}
+
+  /// Conversion from mutable to immutable iterator
+  template <
+    typename OtherBufferT,
+    typename OtherValueT,
+    typename = std::enable_if_t<std::is_convertible<OtherValueT*, ValueT*>::value>>
+  Iterator(const Iterator<OtherBufferT, OtherValueT>& other) : buffer_{other.buffer_}, pos_{other.pos_}
+  {}
+
+  inline reference operator*() const { return (*buffer_)[static_cast<size_type>(pos_)]; }
+  inline pointer operator->() const { return std::addressof(**this); }
+  inline reference operator[](const difference_type n) const { return *(*this + n); }
+
+  inline Iterator& operator++() { return ++pos_, *this; }
+  inline Iterator& operator--() { return --pos_, *this; }
+  inline Iterator operator++(int) { return Iterator{buffer_, pos_++}; }
+  inline Iterator operator--(int) { return Iterator{buffer_, pos_--}; }
+  inline Iterator& operator+=(const difference_type n) { return pos_ += n, *this; }
+  inline Iterator& operator-=(const difference_type n) { return pos_ -= n, *this; }
+  inline Iterator operator+(const difference_type n) const { return Iterator{buffer_, pos_ + n}; }
+  inline Iterator operator-(const difference_type n) const { return Iterator{buffer_, pos_ - n}; }
+  inline friend Iterator operator+(const difference_type n, const Iterator& itr) { return itr + n; }
+  inline difference_type operator-(const Iterator& other) const { return pos_ - other.pos_; }
+
+  inline bool operator==(const Iterator& other) const { return pos_ == other.pos_; }
+  inline bool operator!=(const Iterator& other) const { return pos_ != other.pos_; }
+  inline bool operator<(const Iterator& other) const { return pos_ < other.pos_; }
+  inline bool operator>(const Iterator& other) const { return pos_ > other.pos_; }
+  inline bool operator<=(const Iterator& other) const { return pos_ <= other.pos_; }
+  inline bool operator>=(const Iterator& other) const { return pos_ >= other.pos_; }
+
+private:
+  template <typename OtherBufferT, typename OtherValueT> friend class Iterator;
+  friend class RingBuffer;
+
+  /// Associated buffer
+  BufferT* buffer_ = nullptr;
+
+  /// Logical position within buffer
+  difference_type pos_ = 0;
+};
+
+}  // namespace flow
+
+// Flow (implementation)
+#include <flow/impl/container/ring_buffer.hpp>
+
+#endif  // FLOW_CONTAINER_RING_BUFFER_HPP
@@ -0,0 +1,78 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_CONTAINER_SPLICE_INSERTER_HPP
+#define FLOW_CONTAINER_SPLICE_INSERTER_HPP
+
+// C++ Standard Library
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <utility>
+
+namespace flow
+{
+
+/**
+ * @brief Output iterator which appends to a list-like container, and which enables splicing captured data
+ *
+ * Behaves like <code>std::back_insert_iterator</code>. Additionally, when used as a capture output for a captor
+ * whose container is \p ContainerT, captors which extract a prefix of their queue (e.g.
+ * <code>follower::AnyBefore</code> and <code>driver::Chunk</code>) relink captured elements onto the end of the
+ * output container with <code>ContainerT::splice</code>, rather than moving them element by element.
+ *
+ * @tparam ContainerT  list-like container, such as <code>RecyclingList</code> or <code>std::list</code>
+ */
+template <typename ContainerT> class SpliceInserter
+{
+public:
+  using iterator_category = std::output_iterator_tag;
+  using value_type = void;
+  using difference_type = std::ptrdiff_t;
+  using pointer = void;
+  using reference = void;
+
+  /// Container type
+  using container_type = ContainerT;
+
+  explicit SpliceInserter(ContainerT& container) : container_{std::addressof(container)} {}
+
+  inline SpliceInserter& operator=(const typename ContainerT::value_type& value)
+  {
+    container_->push_back(value);
+    return *this;
+  }
+
+  inline SpliceInserter& operator=(typename ContainerT::value_type&& value)
+  {
+    container_->push_back(std::move(value));
+    return *this;
+  }
+
+  inline SpliceInserter& operator*() { return *this; }
+  inline SpliceInserter& operator++() { return *this; }
+  inline SpliceInserter operator++(int) { return *this; }
+
+  /**
+   * @brief Returns output container
+   */
+  inline ContainerT& container() const { return *container_; }
+
+private:
+  /// Output container
+  ContainerT* container_;
+};
+
+
+/**
+ * @brief Creates a SpliceInserter which appends to \p container
+ */
+template <typename ContainerT> inline SpliceInserter<ContainerT> splice_inserter(ContainerT& container)
+{
+  return SpliceInserter<ContainerT>{container};
+}
+
+}  // namespace flow
+
+#endif  // FLOW_CONTAINER_SPLICE_INSERTER_HPP
@@ -0,0 +1,161 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_CONTAINER_STAMP_INDEXED_HPP
+#define FLOW_CONTAINER_STAMP_INDEXED_HPP
+
+// C++ Standard Library
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+// Flow
+#include <flow/utility/stamp_search.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Container wrapper which enables a dense stamp index in a DispatchQueue
+ *
+ * When used as a <code>DispatchQueue</code> (or captor) container, the queue keeps a contiguous copy of all
+ * element stamps, in lockstep with the underlying container. All stamp searches are then run on this index,
+ * which keeps locate cost independent of dispatch payload size. This is most useful for large dispatch types.
+ * \n
+ * Stamps are stored as <code>StampKey<stamp_type>::key_type</code> values. Integral keys (including those of
+ * <code>std::chrono::time_point</code> stamps; see <code>flow/dispatch/chrono.hpp</code>) are searched with
+ * SIMD kernels, where available.
+ * \n
+ * Elements of a <code>StampIndexed</code> container should not have their stamps modified in place.
+ *
+ * @tparam ContainerT  underlying <code>DispatchT</code> container implementation
+ */
+template <typename ContainerT> class StampIndexed : public ContainerT
+{
+public:
+  using ContainerT::ContainerT;
+
+  StampIndexed() = default;
+};
+
+/**
+ * @brief Checks if a container type is wrapped with <code>StampIndexed</code>
+ */
+template <typename ContainerT> struct IsStampIndexed : std::false_type
+{};
+
+/**
+ * @copydoc IsStampIndexed
+ */
+template <typename ContainerT> struct IsStampIndexed<StampIndexed<ContainerT>> : std::true_type
+{};
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/**
+ * @brief Contiguous stamp key index, kept in lockstep with DispatchQueue storage
+ *
+ * Keys are held in a single array. Removed keys at the front are skipped over using a head offset, and are
+ * compacted away once they make up over half of the array, such that removal is amortized constant time.
+ *
+ * @tparam StampT  dispatch stamp type
+ */
+template <typename StampT> class StampIndex
+{
+public:
+  using size_type = std::size_t;
+
+  using key_type = typename StampKey<StampT>::key_type;
+
+  StampIndex() = default;
+
+  template <typename IteratorT, typename AccessStampT>
+  StampIndex(IteratorT first, const IteratorT last, const AccessStampT& access_stamp)
+  {
+    for (; first != last; ++first)
+    {
+      keys_.emplace_back(to_key(access_stamp.get(*first)));
+    }
+  }
+
+  static constexpr key_type to_key(const StampT& stamp) { return StampKey<StampT>::get(stamp); }
+
+  size_type size() const { return keys_.size() - head_; }
+
+  const key_type& operator[](const size_type pos) const { return keys_[head_ + pos]; }
+
+  const key_type& back() const { return keys_.back(); }
+
+  void emplace_back(const key_type& key) { keys_.emplace_back(key); }
+
+  inline void emplace_front(const key_type& key);
+
+  void emplace(const size_type pos, const key_type& key) { keys_.emplace(keys_.begin() + head_ + pos, key); }
+
+  void erase(const size_type pos) { keys_.erase(keys_.begin() + head_ + pos); }
+
+  inline void pop_front(const size_type n);
+
+  void pop_back(const size_type n) { keys_.resize(keys_.size() - n); }
+
+  void clear()
+  {
+    keys_.clear();
+    head_ = 0UL;
+  }
+
+  inline size_type lower_bound(const size_type first, const StampT& stamp) const;
+
+  inline size_type upper_bound(const size_type first, const StampT& stamp) const;
+
+  inline size_type lower_bound_from_front(const size_type first, const StampT& stamp) const;
+
+  inline size_type upper_bound_from_front(const size_type first, const StampT& stamp) const;
+
+  size_type upper_bound_from_back(const key_type& key) const
+  {
+    return stamp_upper_bound_from_back(keys_.data() + head_, size(), key);
+  }
+
+private:
+  /// Dense key storage
+  std::vector<key_type> keys_;
+
+  /// Position of first valid key
+  size_type head_ = 0UL;
+};
+
+/**
+ * @brief Stand-in for StampIndex when indexing is disabled
+ */
+struct NoStampIndex
+{
+  NoStampIndex() = default;
+
+  template <typename IteratorT, typename AccessStampT>
+  NoStampIndex(const IteratorT first, const IteratorT last, const AccessStampT& access_stamp)
+  {}
+
+  template <typename StampT> static constexpr const StampT& to_key(const StampT& stamp) { return stamp; }
+
+  template <typename KeyT> constexpr void emplace_back(const KeyT& key) const {}
+
+  constexpr void pop_front(const std::size_t n) const {}
+
+  constexpr void pop_back(const std::size_t n) const {}
+
+  constexpr void clear() const {}
+};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+}  // namespace flow
+
+// Flow (implementation)
+#include <flow/impl/container/stamp_indexed.hpp>
+
+#endif  // FLOW_CONTAINER_STAMP_INDEXED_HPP
@@ -12,6 +12,7 @@
 
 // Flow
 #include <flow/dispatch.hpp>
+#include <flow/utility/stamp_search.hpp>
 
 namespace flow
 {
@@ -37,6 +38,26 @@ template <typename ClockT, typename DurationT> struct StampTraits<std::chrono::t
   static constexpr stamp_type max() { return stamp_type::max(); };
 };
 
+/**
+ * @brief Helper struct used to map <chrono> time types onto a flat search key
+ *
+ * Time points are searched using their tick count since epoch, which allows integral search kernels to be used
+ *
+ * @tparam ClockT     clock on which this time point is measured
+ * @tparam DurationT  <code>std::chrono::duration</code> type used to measure the time since epoch
+ */
+template <typename ClockT, typename DurationT> struct StampKey<std::chrono::time_point<ClockT, DurationT>>
+{
+  /// Search key type
+  using key_type = typename DurationT::rep;
+
+  /// Returns search key associated with \p stamp
+  static constexpr key_type get(const std::chrono::time_point<ClockT, DurationT>& stamp)
+  {
+    return stamp.time_since_epoch().count();
+  }
+};
+
 }  // namespace flow
 
 #endif  // FLOW_CAPTOR_DISPATCH_CHRONO_H
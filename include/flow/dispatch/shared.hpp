@@ -0,0 +1,104 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ *
+ * @file shared.h
+ */
+#ifndef FLOW_CAPTOR_DISPATCH_SHARED_H
+#define FLOW_CAPTOR_DISPATCH_SHARED_H
+
+// C++ Standard Library
+#include <memory>
+#include <utility>
+
+// Flow
+#include <flow/dispatch.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Dispatch data wrapper which holds its value behind a reference-counted handle
+ *
+ * Copies of a SharedDispatch share a single, immutable value. Copying a SharedDispatch out of a captor queue (e.g.
+ * with <code>driver::Batch</code>, <code>follower::CountBefore</code>, <code>follower::Ranged</code> or
+ * <code>follower::Latched</code>) costs a reference count increment, rather than a copy of the value. This is
+ * meant for data with large payloads, which are expensive to copy.
+ *
+ * May be used in place of Dispatch with any captor, without other changes
+ *
+ * @tparam StampT  sequencing stamp type; used for data ordering (e.g. time, sequence number, etc.)
+ * @tparam ValueT  data value type
+ */
+template <typename StampT, typename ValueT> class SharedDispatch
+{
+public:
+  /**
+   * @brief Default constructor
+   *
+   * Holds a value-initialized value, as with Dispatch, so that value access never dereferences a null handle
+   */
+  SharedDispatch() : stamp{}, value{std::make_shared<const ValueT>()} {}
+
+  /**
+   * @brief Dispatch value constructor (move enabled)
+   *
+   * Value is constructed in shared storage, as with <code>ValueT(_value_args...)</code>
+   */
+  template <typename... ValueArgsTs>
+  explicit SharedDispatch(const StampT& _stamp, ValueArgsTs&&... _value_args) :
+      stamp{_stamp},
+      value{std::make_shared<const ValueT>(std::forward<ValueArgsTs>(_value_args)...)}
+  {}
+
+  /**
+   * @brief Dispatch conversion constructor
+   *
+   * Moves value of \p dispatch into shared storage
+   */
+  explicit SharedDispatch(Dispatch<StampT, ValueT> dispatch) :
+      stamp{dispatch.stamp},
+      value{std::make_shared<const ValueT>(std::move(dispatch.value))}
+  {}
+
+  /// Sequencing stamp associated with data
+  StampT stamp;
+
+  /// Shared data element
+  std::shared_ptr<const ValueT> value;
+};
+
+
+/**
+ * @copydoc DispatchTraits
+ *
+ * @note partial specialization for SharedDispatch
+ */
+template <typename StampT, typename ValueT> struct DispatchTraits<SharedDispatch<StampT, ValueT>>
+{
+  /// Dispatch stamp type
+  using stamp_type = StampT;
+
+  /// Dispatch data type
+  using value_type = ValueT;
+};
+
+
+/**
+ * @copydoc DispatchAccess
+ *
+ * @note partial specialization for SharedDispatch
+ */
+template <typename StampT, typename ValueT> struct DispatchAccess<SharedDispatch<StampT, ValueT>>
+{
+  /// Selects type of lesser size to use when returning values
+  template <typename T> using return_t = std::conditional_t<(sizeof(T) <= sizeof(T&)), T, const T&>;
+
+  static constexpr return_t<StampT> stamp(const SharedDispatch<StampT, ValueT>& dispatch) { return dispatch.stamp; }
+
+  static inline const ValueT& value(const SharedDispatch<StampT, ValueT>& dispatch) { return *dispatch.value; }
+};
+
+}  // namespace flow
+
+#endif  // FLOW_CAPTOR_DISPATCH_SHARED_H
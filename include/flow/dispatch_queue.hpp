@@ -6,10 +6,13 @@
 #define FLOW_DISPATCH_QUEUE_HPP
 
 // C++ Standard Library
+#include <cstdint>
 #include <type_traits>
 #include <utility>
 
 // Flow
+#include <flow/container/splice_inserter.hpp>
+#include <flow/container/stamp_indexed.hpp>
 #include <flow/dispatch.hpp>
 
 namespace flow
@@ -45,6 +48,48 @@ struct ExtractionRange
   ExtractionRange(const std::size_t _first, const std::size_t _last) : first{_first}, last{_last} {}
 };
 
+/**
+ * @brief Counters describing how far back from the newest element inserted data was placed
+ *
+ * Insertion depth is the number of queued elements which are newer than an inserted element. Data which arrives in
+ * stamp order has a depth of zero. Only elements which are added to the queue are counted; duplicates, and elements
+ * dropped to respect a capacity, are not.
+ */
+struct InsertionStats
+{
+  /// Number of elements inserted as the newest element
+  std::size_t in_order = 0UL;
+
+  /// Number of elements inserted before one or more newer elements
+  std::size_t out_of_order = 0UL;
+
+  /// Sum of all out-of-order insertion depths
+  std::size_t total_depth = 0UL;
+
+  /// Largest insertion depth
+  std::size_t max_depth = 0UL;
+};
+
+/**
+ * @brief Position carried from one DispatchQueue stamp search to the next
+ *
+ * Lets a caller whose search stamps do not decrease between calls (e.g. a follower searching relative to driver
+ * stamps) resume each search from where the previous one ended, rather than from the oldest element
+ *
+ * @tparam StampT  dispatch stamp type
+ */
+template <typename StampT> struct SearchCursor
+{
+  /// Position of previous search result, counted from the first element ever held by the queue
+  std::uint64_t position = 0UL;
+
+  /// Stamp of previous search
+  StampT stamp = StampT{};
+
+  /// Set once cursor holds a search result
+  bool valid = false;
+};
+
 /**
  * @brief Default implementation for accessing dispatch stamps
  */
@@ -67,7 +112,9 @@ struct DefaultValueAccess
  * FILO-type queue which orders data by sequence stamp, from oldest to newest. Provides
  * useful methods for extracting data within stamped/counted ranges
  * \n
- * This template provides an interface wrapper around a specifiable container implementation.
+ * This template provides an interface wrapper around a specifiable container implementation. When
+ * <code>ContainerT</code> is wrapped with <code>StampIndexed</code>, stamps are additionally kept in a dense index,
+ * which is used for all stamp searches.
  *
  * @tparam DispatchT  data dipatch type
  * @tparam ContainerT  underlying <code>DispatchT</code> container timplementation
@@ -148,6 +195,30 @@ public:
   template <typename OutputDispatchIteratorT>
   inline OutputDispatchIteratorT move(OutputDispatchIteratorT output, const ExtractionRange& extraction_range);
 
+  /**
+   * @brief Moves the first \p n elements to \p output and removes them from the queue
+   *
+   * @param output  element output iterator
+   * @param n  number of elements to extract
+   *
+   * @return output iterator following the last extracted element
+   */
+  template <typename OutputDispatchIteratorT>
+  inline OutputDispatchIteratorT extract_first_n(OutputDispatchIteratorT output, const size_type n);
+
+  /**
+   * @copybrief extract_first_n
+   *
+   * Elements are relinked onto the end of the output container with <code>ContainerT::splice</code>, rather than
+   * being moved one by one
+   *
+   * @param output  inserter for a container of the same type as the underlying container
+   * @param n  number of elements to extract
+   *
+   * @return \p output
+   */
+  inline SpliceInserter<ContainerT> extract_first_n(SpliceInserter<ContainerT> output, const size_type n);
+
   /**
    * @brief Returns first iterator to element before stamp
    *
@@ -156,6 +227,65 @@ public:
    */
   inline const_iterator before(stamp_const_arg_type stamp) const;
 
+  /**
+   * @brief Returns iterator to first element with stamp not less than \c stamp
+   *
+   * Uses binary search when <code>ContainerT</code> provides random-access iterators
+   *
+   * @param stamp  sequencing stamp
+   * @return <code>const_iterator</code> to first element with stamp <code>>= stamp</code>, or <code>end()</code>
+   */
+  inline const_iterator lower_bound(stamp_const_arg_type stamp) const { return lower_bound(begin(), stamp); }
+
+  /**
+   * @copydoc DispatchQueue::lower_bound
+   *
+   * @param first  iterator from which to begin search
+   */
+  inline const_iterator lower_bound(const_iterator first, stamp_const_arg_type stamp) const;
+
+  /**
+   * @brief Returns iterator to first element with stamp greater than \c stamp
+   *
+   * Uses binary search when <code>ContainerT</code> provides random-access iterators
+   *
+   * @param stamp  sequencing stamp
+   * @return <code>const_iterator</code> to first element with stamp <code>> stamp</code>, or <code>end()</code>
+   */
+  inline const_iterator upper_bound(stamp_const_arg_type stamp) const { return upper_bound(begin(), stamp); }
+
+  /**
+   * @copydoc DispatchQueue::upper_bound
+   *
+   * @param first  iterator from which to begin search
+   */
+  inline const_iterator upper_bound(const_iterator first, stamp_const_arg_type stamp) const;
+
+  /**
+   * @copybrief DispatchQueue::lower_bound
+   *
+   * Resumes from the result of the previous search made with \p cursor, when \p stamp is not less than the stamp
+   * of that search, by galloping forwards with exponentially growing steps; otherwise, searches from the oldest
+   * element. Elements removed from the front and elements inserted before the cursor position do not invalidate
+   * the cursor, since neither can place an element at or after the previous search stamp before it. Cost scales
+   * with the distance moved from the previous result rather than with queue size, when <code>ContainerT</code>
+   * provides random-access iterators.
+   *
+   * @param[in,out] cursor  result of previous search; updated with the result of this search
+   * @param stamp  sequencing stamp
+   * @return <code>const_iterator</code> to first element with stamp <code>>= stamp</code>, or <code>end()</code>
+   *
+   * @warning A cursor must only be used with one of <code>lower_bound</code> or <code>upper_bound</code>
+   */
+  inline const_iterator lower_bound(SearchCursor<stamp_type>& cursor, stamp_const_arg_type stamp) const;
+
+  /**
+   * @copybrief DispatchQueue::upper_bound
+   *
+   * @copydetails DispatchQueue::lower_bound(SearchCursor<stamp_type>&, stamp_const_arg_type) const
+   */
+  inline const_iterator upper_bound(SearchCursor<stamp_type>& cursor, stamp_const_arg_type stamp) const;
+
   /**
    * @brief Returns first iterator to underlying ordered data structure
    * @return <code>const_iterator</code> to first Dispatch resource
@@ -260,20 +390,166 @@ public:
   /**
    * @brief Inserts data in sequence stamp order as Dispatch
    *
+   * Placement is found by galloping backwards from the newest element, so cost scales with how far out of order
+   * data arrives, rather than with queue size
+   *
    * @param dispatch_args  dispatch constructor args
    *
    * @warning elements with stamps identical to existing element stamps are not added
    */
   template <typename... DispatchConstructorArgTs> inline void insert(DispatchConstructorArgTs&&... dispatch_args);
 
+  /**
+   * @copybrief insert
+   *
+   * Moves \p dispatch into place without constructing an intermediate Dispatch, such that callers may fully build
+   * data before locking the queue
+   *
+   * @param dispatch  data to insert
+   *
+   * @warning elements with stamps identical to existing element stamps are not added
+   */
+  inline void insert(DispatchT&& dispatch);
+
+  /**
+   * @brief Inserts data in sequence stamp order as Dispatch, removing oldest elements to respect \p capacity
+   *
+   * Oldest elements are removed before the new element is added, such that queue size never exceeds \p capacity.
+   * When the new element would itself be the oldest element of a full queue, it is not added.
+   *
+   * @param capacity  maximum queue size; no limit is applied if <code>capacity == 0</code>
+   * @param dispatch_args  dispatch constructor args
+   *
+   * @return number of elements dropped to respect \p capacity, including the new element, if it was not added
+   *
+   * @warning elements with stamps identical to existing element stamps are not added
+   */
+  template <typename... DispatchConstructorArgTs>
+  inline size_type insert_and_limit(const size_type capacity, DispatchConstructorArgTs&&... dispatch_args);
+
+  /**
+   * @copybrief insert_and_limit
+   *
+   * Moves \p dispatch into place without constructing an intermediate Dispatch, such that callers may fully build
+   * data before locking the queue
+   *
+   * @param capacity  maximum queue size; no limit is applied if <code>capacity == 0</code>
+   * @param dispatch  data to insert
+   *
+   * @return number of elements dropped to respect \p capacity, including the new element, if it was not added
+   */
+  inline size_type insert_and_limit(const size_type capacity, DispatchT&& dispatch);
+
+  /**
+   * @brief Merges a range of Dispatch elements, sorted by sequence stamp, into the queue
+   *
+   * Each element is placed as with <code>insert_and_limit</code>, searching from the newest queued element, so a range
+   * which is newer than all queued data is appended without searching. Queued elements stay in place while merging;
+   * no temporary storage is used, and an exception leaves all previously queued and merged elements in the queue.
+   *
+   * @param first  iterator to first Dispatch in stamp-sorted range
+   * @param last  iterator to one past last Dispatch in stamp-sorted range
+   * @param capacity  if non-zero, oldest elements are removed while merging such that queue size never exceeds
+   *                  \p capacity
+   *
+   * @return number of elements removed to respect \p capacity
+   *
+   * @note Elements are moved, rather than copied, into the queue when \p first and \p last are move iterators
+   *
+   * @warning elements with stamps identical to existing (or previously merged) element stamps are not added
+   */
+  template <typename ForwardDispatchIteratorT>
+  inline size_type merge(ForwardDispatchIteratorT first, const ForwardDispatchIteratorT last, const size_type capacity = 0);
+
+  /**
+   * @brief Returns insertion depth counters accumulated over all calls to <code>insert</code> and <code>merge</code>
+   */
+  inline const InsertionStats& get_insertion_stats() const { return insertion_stats_; }
+
+  /**
+   * @brief Resets insertion depth counters
+   */
+  inline void reset_insertion_stats() { insertion_stats_ = InsertionStats{}; }
+
+  /**
+   * @brief Returns a counter which changes whenever queued data may have changed
+   *
+   * Incremented by every call which adds, removes or moves out elements, so that results derived from queued data
+   * (e.g. an ExtractionRange) may be reused for as long as the counter is unchanged
+   */
+  inline std::uint64_t generation() const { return generation_; }
+
   /**
    * @brief Returns the underlying storage container
    */
   inline const ContainerT& get_container() const noexcept;
 
 private:
+  /// Stamp index enabled/disabled tag
+  using HasStampIndex = IsStampIndexed<ContainerT>;
+
+  /// Stamp index type
+  using StampIndexType = std::conditional_t<HasStampIndex::value, detail::StampIndex<stamp_type>, detail::NoStampIndex>;
+
+  /**
+   * @brief Removes all elements before \c last with a single range erase
+   */
+  inline void erase_front(const const_iterator last);
+
+  inline const_iterator lower_bound_impl(const_iterator first, stamp_const_arg_type stamp, std::false_type) const;
+
+  inline const_iterator lower_bound_impl(const_iterator first, stamp_const_arg_type stamp, std::true_type) const;
+
+  inline const_iterator upper_bound_impl(const_iterator first, stamp_const_arg_type stamp, std::false_type) const;
+
+  inline const_iterator upper_bound_impl(const_iterator first, stamp_const_arg_type stamp, std::true_type) const;
+
+  /**
+   * @brief Returns the position from which a search with \c cursor may resume
+   */
+  inline size_type resume_position(const SearchCursor<stamp_type>& cursor, stamp_const_arg_type stamp) const;
+
+  /**
+   * @brief Returns first element with stamp not less than \c stamp, galloping forwards from position \c pos
+   *
+   * \c pos is updated with the position of the returned element
+   */
+  inline const_iterator lower_bound_from_front(size_type& pos, stamp_const_arg_type stamp, std::false_type) const;
+
+  inline const_iterator lower_bound_from_front(size_type& pos, stamp_const_arg_type stamp, std::true_type) const;
+
+  /**
+   * @brief Returns first element with stamp greater than \c stamp, galloping forwards from position \c pos
+   *
+   * \c pos is updated with the position of the returned element
+   */
+  inline const_iterator upper_bound_from_front(size_type& pos, stamp_const_arg_type stamp, std::false_type) const;
+
+  inline const_iterator upper_bound_from_front(size_type& pos, stamp_const_arg_type stamp, std::true_type) const;
+
+  inline size_type insert_impl(DispatchT&& dispatch, const size_type capacity, std::false_type);
+
+  inline size_type insert_impl(DispatchT&& dispatch, const size_type capacity, std::true_type);
+
+  /**
+   * @brief Updates insertion counters with the number of queued elements newer than an inserted element
+   */
+  inline void record_insertion(const size_type depth);
+
   /// Queued data dispatches
   ContainerT container_;
+
+  /// Dense stamp index (when enabled)
+  StampIndexType index_;
+
+  /// Insertion depth counters
+  InsertionStats insertion_stats_;
+
+  /// Number of elements ever removed from the front of the queue; position of the oldest element for SearchCursor
+  std::uint64_t front_position_ = 0UL;
+
+  /// Queue modification counter
+  std::uint64_t generation_ = 0UL;
 };
 
 }  // namespace flow
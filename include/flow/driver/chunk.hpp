@@ -100,6 +100,11 @@ private:
    */
   inline void reset_driver_impl() noexcept(true) {}
 
+  /**
+   * @brief Returns wake threshold; capture is only possible once chunk size elements are queued
+   */
+  inline WakeThreshold<stamp_type> wake_threshold_driver_impl() const { return WakeThreshold<stamp_type>{chunk_size_}; }
+
   /**
    * @brief Validates captor configuration
    */
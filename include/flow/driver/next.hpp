@@ -91,6 +91,11 @@ private:
    * @copydoc Driver::reset_policy_impl
    */
   inline void reset_driver_impl() noexcept(true) {}
+
+  /**
+   * @brief Returns wake threshold; capture is only possible once any element is queued
+   */
+  static constexpr WakeThreshold<stamp_type> wake_threshold_driver_impl() { return WakeThreshold<stamp_type>{1UL}; }
 };
 
 }  // namespace driver
@@ -100,6 +100,17 @@ private:
    */
   inline void reset_driver_impl();
 
+  /**
+   * @brief Returns wake threshold; capture is only possible once an element a full throttle period after the last
+   *        capture is queued
+   */
+  inline WakeThreshold<stamp_type> wake_threshold_driver_impl() const
+  {
+    return (previous_stamp_ == StampTraits<stamp_type>::min())
+      ? WakeThreshold<stamp_type>{1UL}
+      : WakeThreshold<stamp_type>{1UL, previous_stamp_ + throttle_period_};
+  }
+
   /// Capture throttling period
   offset_type throttle_period_;
 
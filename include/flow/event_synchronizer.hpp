@@ -0,0 +1,180 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_EVENT_SYNCHRONIZER_HPP
+#define FLOW_EVENT_SYNCHRONIZER_HPP
+
+// C++ Standard Library
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+// Flow
+#include <flow/group_notifier.hpp>
+#include <flow/synchronizer.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Synchronizes a fixed set of captors from the threads which inject data, with no capture thread
+ *
+ * On construction, each captor is attached to its own GroupNotifier, whose callback re-checks synchronization
+ * whenever that captor changes. A re-check locks all captors once, and captures every ready frame into buffers sized
+ * exactly from the located frame (see <code>CaptorInterface::extract_size_locked</code>). Each frame is then passed
+ * to a user frame callback, which is run inline after all captor locks have been released, or is posted to a
+ * user-supplied executor.
+ * \n
+ * Re-checks are incremental: when synchronization is not yet possible, the group remembers which captor ended it (the
+ * driver, or the first follower which was not ready), and changes to any other captor return right away, without
+ * taking a lock. Only changes to that blocking captor, and calls to <code>poll</code>, locate again. Concurrent
+ * re-checks are coalesced: a thread which changes a captor while another thread is capturing frames leaves the
+ * re-check to that thread, rather than waiting for it.
+ * \n
+ * Works with any mix of lock policies.
+ *
+ * @tparam CaptorTs  captor types, as (DriverType, FollowerTypes...)
+ *
+ * @warning Captors must outlive the group, must not be in more than one group at a time, and must not be changed
+ *          while the group is being destroyed
+ */
+template <typename... CaptorTs> class EventSynchronizer
+{
+public:
+  /// Tuple of captor references
+  using CaptorTupleType = std::tuple<CaptorTs&...>;
+
+  /// Synchronization result type
+  using result_type = Synchronizer::result_t<CaptorTupleType>;
+
+  /// Stamp type
+  using stamp_type = Synchronizer::stamp_t<CaptorTupleType>;
+
+  /// Data captured for one frame, as one buffer per captor
+  using frame_type = std::tuple<std::vector<typename CaptorTraits<CaptorTs>::DispatchType>...>;
+
+  /// Callback invoked with each captured frame
+  using frame_callback_type = std::function<void(const result_type&, frame_type&&)>;
+
+  /// Executor which runs posted tasks, e.g. by queueing them on a thread pool
+  using executor_type = std::function<void(std::function<void()>)>;
+
+  /**
+   * @brief Attaches \p captors, and invokes \p frame_callback inline with each frame
+   *
+   * @param frame_callback  callback invoked with each captured frame, from the thread which completed it
+   * @param captors  captors used to perform synchronization, as (driver, followers...)
+   */
+  explicit EventSynchronizer(frame_callback_type frame_callback, CaptorTs&... captors);
+
+  /**
+   * @brief Attaches \p captors, and posts each call to \p frame_callback to \p executor
+   *
+   * @param frame_callback  callback invoked with each captured frame
+   * @param executor  executor which runs frame callbacks; frames are posted in capture order
+   * @param captors  captors used to perform synchronization, as (driver, followers...)
+   *
+   * @warning Posted tasks refer to this object; they must run before it is destroyed
+   */
+  EventSynchronizer(frame_callback_type frame_callback, executor_type executor, CaptorTs&... captors);
+
+  EventSynchronizer(const EventSynchronizer&) = delete;
+
+  EventSynchronizer& operator=(const EventSynchronizer&) = delete;
+
+  /**
+   * @brief Detaches captors
+   */
+  ~EventSynchronizer();
+
+  /**
+   * @brief Captures all ready frames now, regardless of which captor last changed
+   */
+  void poll();
+
+  /**
+   * @copydoc Synchronizer::remove
+   */
+  inline void remove(const stamp_type t_remove)
+  {
+    Synchronizer::remove(CaptorTupleType{captors_}, t_remove);
+    poll();
+  }
+
+  /**
+   * @copydoc Synchronizer::abort
+   */
+  inline void abort(const stamp_type t_abort)
+  {
+    Synchronizer::abort(CaptorTupleType{captors_}, t_abort);
+    poll();
+  }
+
+  /**
+   * @copydoc Synchronizer::reset
+   */
+  inline void reset()
+  {
+    Synchronizer::reset(CaptorTupleType{captors_});
+    poll();
+  }
+
+  /**
+   * @brief Returns index of the captor whose changes trigger the next re-check, or the number of captors if changes
+   *        to any captor will
+   */
+  inline std::size_t blocking_index() const { return blocking_index_.load(); }
+
+private:
+  /// Number of captors
+  static constexpr std::size_t N_CAPTORS = sizeof...(CaptorTs);
+
+  /// Called after captor at \p captor_index changes
+  void on_change(const std::size_t captor_index);
+
+  /// Captures ready frames, unless another thread is already doing so
+  void request();
+
+  /// Captures frames until synchronization is no longer possible
+  void capture_ready();
+
+  /// Invokes frame callback, or posts it to executor
+  void dispatch(const result_type& result, frame_type&& frame);
+
+  /// Captors used to perform synchronization
+  CaptorTupleType captors_;
+
+  /// Notifier signaled by each captor
+  std::array<GroupNotifier, N_CAPTORS> notifiers_;
+
+  /// Callback invoked with each captured frame
+  frame_callback_type frame_callback_;
+
+  /// Executor which runs frame callbacks, or empty to run them inline
+  executor_type executor_;
+
+  /// Index of captor which ended last synchronization attempt, or N_CAPTORS if unknown
+  std::atomic<std::size_t> blocking_index_;
+
+  /// Number of re-check requests so far
+  std::atomic<std::uint64_t> requests_;
+
+  /// Set while a thread is capturing frames
+  std::atomic<bool> capturing_;
+
+  /// Frames captured under captor locks, to be dispatched once they are released
+  std::vector<std::pair<result_type, frame_type>> ready_frames_;
+};
+
+}  // namespace flow
+
+// Flow (implementation)
+#include <flow/impl/event_synchronizer.hpp>
+
+#endif  // FLOW_EVENT_SYNCHRONIZER_HPP
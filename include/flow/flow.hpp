@@ -7,8 +7,10 @@
 
 // Flow
 #include <flow/drivers.hpp>
+#include <flow/event_synchronizer.hpp>
 #include <flow/followers.hpp>
 #include <flow/synchronizer.hpp>
+#include <flow/synchronizer_group.hpp>
 
 /**
  * @brief Flow input synchronization library components
@@ -110,6 +110,9 @@ private:
 
   /// Capture delay
   offset_type delay_;
+
+  /// Position of previous boundary search, from which the next search resumes
+  mutable SearchCursor<stamp_type> cursor_;
 };
 
 }  // namespace follower
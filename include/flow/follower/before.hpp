@@ -96,8 +96,19 @@ private:
    */
   inline void reset_follower_impl() noexcept(true) {}
 
+  /**
+   * @brief Returns wake threshold; capture is only possible once an element at or after the capture boundary is queued
+   */
+  inline WakeThreshold<stamp_type> wake_threshold_follower_impl(const CaptureRange<stamp_type>& range) const
+  {
+    return WakeThreshold<stamp_type>{1UL, range.upper_stamp - delay_};
+  }
+
   /// Capture delay
   offset_type delay_;
+
+  /// Position of previous boundary search, from which the next search resumes
+  mutable SearchCursor<stamp_type> cursor_;
 };
 
 }  // namespace follower
@@ -95,6 +95,14 @@ private:
     const ExtractionRange& extraction_range,
     const CaptureRange<stamp_type>& range);
 
+  /**
+   * @brief Outputs, at most, the one located element closest to the capture boundary
+   */
+  static constexpr std::size_t extract_size_follower_impl(const ExtractionRange& extraction_range)
+  {
+    return extraction_range ? 1UL : 0UL;
+  }
+
   /**
    * @copydoc Follower::abort_policy_impl
    */
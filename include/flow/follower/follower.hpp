@@ -6,6 +6,7 @@
 #define FLOW_FOLLOWER_FOLLOWER_HPP
 
 // C++ Standard Library
+#include <cstddef>
 #include <type_traits>
 
 // Flow
@@ -101,6 +102,21 @@ private:
    */
   inline void reset_policy_impl();
 
+  /**
+   * @brief Returns queue state which must be reached before a capture which returned <code>State::RETRY</code> could
+   *        change state
+   *
+   * @param range  data capture/sequencing range
+   */
+  inline WakeThreshold<stamp_type> wake_threshold_policy_impl(const CaptureRange<stamp_type>& range) const;
+
+  /**
+   * @brief Returns the number of elements which <code>extract_policy_impl</code> outputs for \p extraction_range
+   *
+   * @param extraction_range  range of elements found with <code>locate_policy_impl</code>
+   */
+  inline std::size_t extract_size_policy_impl(const ExtractionRange& extraction_range) const;
+
   FLOW_IMPLEMENT_CRTP_BASE(PolicyT);
 
   using CaptorType = Captor<
@@ -112,6 +128,22 @@ private:
 protected:
   using CaptorType::queue_;
   using CaptorType::queue_monitor_;
+
+  /**
+   * @brief Default wake threshold, which is always met; may be hidden by Follower implementations
+   */
+  static constexpr WakeThreshold<stamp_type> wake_threshold_follower_impl(const CaptureRange<stamp_type>& range)
+  {
+    return WakeThreshold<stamp_type>{};
+  }
+
+  /**
+   * @brief Default extraction size, one output element per located element; may be hidden by Follower implementations
+   */
+  static constexpr std::size_t extract_size_follower_impl(const ExtractionRange& extraction_range)
+  {
+    return extraction_range.last - extraction_range.first;
+  }
 };
 
 
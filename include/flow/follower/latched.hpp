@@ -97,6 +97,14 @@ private:
     const ExtractionRange& extraction_range,
     const CaptureRange<stamp_type>& range);
 
+  /**
+   * @brief Outputs one element, newly latched or previously latched, if any
+   */
+  inline std::size_t extract_size_follower_impl(const ExtractionRange& extraction_range) const
+  {
+    return (extraction_range or latched_) ? 1UL : 0UL;
+  }
+
   /**
    * @brief Defines behavior on <code>ABORT</code>
    *
@@ -116,6 +124,9 @@ private:
 
   /// Number of message before target to accept before ready
   offset_type min_period_;
+
+  /// Position of previous boundary search, from which the next search resumes
+  mutable SearchCursor<stamp_type> cursor_;
 };
 
 }  // namespace follower
@@ -94,6 +94,18 @@ private:
    * @copydoc Follower::reset_policy_impl
    */
   inline void reset_follower_impl() noexcept(true) {}
+
+  /**
+   * @brief Returns wake threshold; capture state only changes once an element at or after the start of the capture
+   *        range is queued
+   */
+  inline WakeThreshold<stamp_type> wake_threshold_follower_impl(const CaptureRange<stamp_type>& range) const
+  {
+    return WakeThreshold<stamp_type>{1UL, range.lower_stamp};
+  }
+
+  /// Position of previous boundary search, from which the next search resumes
+  mutable SearchCursor<stamp_type> cursor_;
 };
 
 }  // namespace follower
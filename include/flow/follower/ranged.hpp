@@ -101,6 +101,17 @@ private:
    */
   inline void reset_follower_impl() noexcept(true) {}
 
+  /**
+   * @brief Returns wake threshold; capture state only changes once an element at or after the (delayed) capture
+   *        range is queued
+   */
+  inline WakeThreshold<stamp_type> wake_threshold_follower_impl(const CaptureRange<stamp_type>& range) const
+  {
+    // While the queue is empty, an element at or after the (delayed) range start changes state, by aborting capture
+    return WakeThreshold<stamp_type>{
+      1UL, PolicyType::queue_.empty() ? (range.lower_stamp - delay_) : (range.upper_stamp - delay_)};
+  }
+
   /**
    * @brief Finds iterator after first in capture sequence
    *
@@ -118,6 +129,9 @@ private:
 
   /// Capture delay
   offset_type delay_;
+
+  /// Position of previous boundary search, from which the next search resumes
+  mutable SearchCursor<stamp_type> cursor_;
 };
 
 }  // namespace follower
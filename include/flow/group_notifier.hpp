@@ -0,0 +1,121 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_GROUP_NOTIFIER_HPP
+#define FLOW_GROUP_NOTIFIER_HPP
+
+// C++ Standard Library
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+
+namespace flow
+{
+
+/**
+ * @brief Notification primitive shared by a group of captors
+ *
+ * Captors attached to a GroupNotifier signal it whenever their buffers change, so that a single thread may wait for
+ * changes to any captor in the group, rather than waiting on each captor in turn. Each change advances a version
+ * counter; waiters wait for the version to move past one they have already observed, so changes made between an
+ * observation and a wait are never missed.
+ * \n
+ * Signaling is lock-free while no thread is waiting. An optional callback may also be run on every signal, from the
+ * signaling thread, after captor locks have been released
+ */
+class GroupNotifier
+{
+public:
+  /// Version counter type
+  using version_type = std::uint64_t;
+
+  /// Callback type run on every notification
+  using callback_type = std::function<void()>;
+
+  GroupNotifier() = default;
+
+  GroupNotifier(const GroupNotifier&) = delete;
+
+  GroupNotifier& operator=(const GroupNotifier&) = delete;
+
+  /**
+   * @brief Returns current version, which changes on every notification
+   */
+  inline version_type version() const { return version_.load(); }
+
+  /**
+   * @brief Signals a change, releasing all waiters
+   */
+  inline void notify()
+  {
+    version_.fetch_add(1UL);
+    if (waiters_.load())
+    {
+      // Synchronize with waiters which have checked the version, but not yet started waiting
+      {
+        std::lock_guard<std::mutex> lock{mutex_};
+      }
+      cv_.notify_all();
+    }
+    if (callback_)
+    {
+      callback_();
+    }
+  }
+
+  /**
+   * @brief Sets callback run by every call to <code>notify</code>, after waiters are released
+   *
+   * @param callback  callback to run, or an empty callback to run nothing
+   *
+   * @warning Not thread-safe; set the callback before attaching captors, and clear it only after detaching them
+   */
+  inline void set_callback(callback_type callback) { callback_ = std::move(callback); }
+
+  /**
+   * @brief Waits until version differs from \p observed_version, or until \p timeout
+   *
+   * @param observed_version  version observed before the caller last checked group state
+   * @param timeout  time at which wait should end
+   *
+   * @retval true  if a change was signaled after \p observed_version
+   * @retval false  on timeout
+   */
+  template <typename ClockT, typename DurationT>
+  inline bool wait(const version_type observed_version, const std::chrono::time_point<ClockT, DurationT>& timeout)
+  {
+    std::unique_lock<std::mutex> lock{mutex_};
+    waiters_.fetch_add(1UL);
+    const auto changed = [this, observed_version] { return version_.load() != observed_version; };
+    const bool signaled = (std::chrono::time_point<ClockT, DurationT>::max() == timeout)
+      ? (cv_.wait(lock, changed), true)
+      : cv_.wait_until(lock, timeout, changed);
+    waiters_.fetch_sub(1UL);
+    return signaled;
+  }
+
+private:
+  /// Number of notifications so far
+  std::atomic<version_type> version_{0UL};
+
+  /// Number of threads waiting, or about to wait
+  std::atomic<std::size_t> waiters_{0UL};
+
+  /// Mutex used to wait on notification
+  std::mutex mutex_;
+
+  /// Condition variable used to wait on notification
+  std::condition_variable cv_;
+
+  /// Callback run on every notification
+  callback_type callback_;
+};
+
+}  // namespace flow
+
+#endif  // FLOW_GROUP_NOTIFIER_HPP
@@ -8,6 +8,7 @@
 #define FLOW_IMPL_CAPTOR_INTERFACE_HPP
 
 // C++ Standard Library
+#include <algorithm>
 #include <iterator>
 #include <memory>
 #include <mutex>
@@ -25,19 +26,243 @@ CaptorInterface<CaptorT>::CaptorInterface(
     capacity_{capacity},
     queue_{container},
     queue_monitor_{queue_monitor}
-{}
+{
+  publish_queue_metadata();
+}
 
 
 template <typename CaptorT>
 template <typename... InsertArgTs>
 void CaptorInterface<CaptorT>::insert_and_limit(InsertArgTs&&... args)
 {
-  queue_.insert(std::forward<InsertArgTs>(args)...);
+  // Queue is frozen while leased; admission is checked on release
+  if (lease_.active)
+  {
+    deferred_dispatches_.push_back(DispatchType{std::forward<InsertArgTs>(args)...});
+    return;
+  }
+
+  // Nothing to check when queue is unbounded
+  if (!capacity_ and admission_policy_ != AdmissionPolicy::REJECT_IF_OLDER_THAN_FRONT)
+  {
+    queue_.insert(std::forward<InsertArgTs>(args)...);
+    return;
+  }
+
+  insert_and_limit_impl(CanPeekStamp<InsertArgTs...>{}, std::forward<InsertArgTs>(args)...);
+}
+
+
+template <typename CaptorT>
+template <typename... InsertArgTs>
+void CaptorInterface<CaptorT>::insert_and_limit_impl(std::true_type, InsertArgTs&&... args)
+{
+  if (admit(peek_stamp(args...)))
+  {
+    admission_stats_.dropped += queue_.insert_and_limit(capacity_, std::forward<InsertArgTs>(args)...);
+  }
+}
+
+
+template <typename CaptorT>
+template <typename... InsertArgTs>
+void CaptorInterface<CaptorT>::insert_and_limit_impl(std::false_type, InsertArgTs&&... args)
+{
+  // Stamp is only available after construction
+  DispatchType dispatch{std::forward<InsertArgTs>(args)...};
+  if (admit(AccessStampType::get(dispatch)))
+  {
+    admission_stats_.dropped += queue_.insert_and_limit(capacity_, std::move(dispatch));
+  }
+}
+
+
+template <typename CaptorT> bool CaptorInterface<CaptorT>::admit(const stamp_type& stamp)
+{
+  if (queue_.empty())
+  {
+    return true;
+  }
+  else if (admission_policy_ == AdmissionPolicy::REJECT_IF_OLDER_THAN_FRONT and stamp < queue_.oldest_stamp())
+  {
+    ++admission_stats_.rejected;
+    return false;
+  }
+  else if (!capacity_ or queue_.size() < capacity_)
+  {
+    return true;
+  }
+  else if (admission_policy_ == AdmissionPolicy::REJECT_INCOMING)
+  {
+    ++admission_stats_.rejected;
+    return false;
+  }
+  else if (stamp < queue_.oldest_stamp())
+  {
+    // New data would be the oldest element of a full queue, and dropped immediately
+    ++admission_stats_.dropped;
+    return false;
+  }
+  return true;
+}
+
+
+template <typename CaptorT>
+template <typename FirstForwardDispatchIteratorT, typename LastForwardDispatchIteratorT>
+std::vector<typename CaptorInterface<CaptorT>::DispatchType>
+CaptorInterface<CaptorT>::sort_by_stamp(FirstForwardDispatchIteratorT first, LastForwardDispatchIteratorT last)
+{
+  std::vector<DispatchType> dispatches;
+  for (; first != last; ++first)
+  {
+    dispatches.emplace_back(*first);
+  }
+
+  const auto stamp_less = [](const DispatchType& lhs, const DispatchType& rhs) {
+    return AccessStampType::get(lhs) < AccessStampType::get(rhs);
+  };
+
+  // Stable sort, so that the first of several elements with identical stamps is kept, as with sequential insertion
+  if (!std::is_sorted(dispatches.begin(), dispatches.end(), stamp_less))
+  {
+    std::stable_sort(dispatches.begin(), dispatches.end(), stamp_less);
+  }
+  return dispatches;
+}
+
+
+template <typename CaptorT>
+void CaptorInterface<CaptorT>::merge_and_limit(std::vector<DispatchType>&& sorted_dispatches)
+{
+  if (lease_.active)
+  {
+    deferred_dispatches_.insert(
+      deferred_dispatches_.end(),
+      std::make_move_iterator(sorted_dispatches.begin()),
+      std::make_move_iterator(sorted_dispatches.end()));
+    return;
+  }
+
+  if (admission_policy_ == AdmissionPolicy::DROP_OLDEST)
+  {
+    admission_stats_.dropped += queue_.merge(
+      std::make_move_iterator(sorted_dispatches.begin()), std::make_move_iterator(sorted_dispatches.end()), capacity_);
+    return;
+  }
+
+  // Admission of each element depends on queue state after previous insertions
+  for (auto& dispatch : sorted_dispatches)
+  {
+    insert_and_limit(std::move(dispatch));
+  }
+}
+
+
+template <typename CaptorT> void CaptorInterface<CaptorT>::publish_queue_metadata()
+{
+  if (queue_.empty())
+  {
+    queue_metadata_.store(QueueMetadata<stamp_type>{});
+  }
+  else
+  {
+    queue_metadata_.store(QueueMetadata<stamp_type>{
+      queue_.size(), CaptureRange<stamp_type>{queue_.oldest_stamp(), queue_.newest_stamp()}});
+  }
+}
+
+
+template <typename CaptorT>
+void CaptorInterface<CaptorT>::defer(const DeferredOperation operation, const stamp_type& stamp)
+{
+  if (operation == DeferredOperation::RESET)
+  {
+    // Nothing requested before a reset survives it
+    deferred_dispatches_.clear();
+    deferred_records_.clear();
+  }
+  deferred_records_.push_back(DeferredRecord{operation, stamp, deferred_dispatches_.size()});
+}
+
 
-  if (capacity_)
+template <typename CaptorT>
+template <typename ExtractFnT>
+std::tuple<State, CaptureView<CaptorT>> CaptorInterface<CaptorT>::lease(
+  const State state,
+  const ExtractionRange& extraction_range,
+  const CaptureRange<stamp_type>& range,
+  ExtractFnT&& extract_fn)
+{
+  if (state != State::PRIMED or !extraction_range)
   {
-    queue_.shrink_to_fit(capacity_);
+    // Nothing to view; apply extraction side-effects (e.g. removal of stale data) immediately
+    detail::DiscardOutputIterator output;
+    extract_fn(output, extraction_range, range);
+    return std::make_tuple(state, CaptureView<CaptorT>{});
   }
+
+  ++lease_.id;
+  lease_.active = true;
+  lease_.extraction_range = extraction_range;
+  lease_.range = range;
+
+  return std::make_tuple(
+    state,
+    CaptureView<CaptorT>{this,
+                         lease_.id,
+                         std::next(queue_.begin(), extraction_range.first),
+                         std::next(queue_.begin(), extraction_range.last)});
+}
+
+
+template <typename CaptorT>
+template <typename ExtractFnT, typename AbortFnT, typename ResetFnT>
+bool CaptorInterface<CaptorT>::end_lease(ExtractFnT&& extract_fn, AbortFnT&& abort_fn, ResetFnT&& reset_fn)
+{
+  if (!lease_.active)
+  {
+    return false;
+  }
+
+  lease_.active = false;
+
+  // Complete capture of leased data, which happens before any changes requested while leased
+  detail::DiscardOutputIterator output;
+  extract_fn(output, lease_.extraction_range, lease_.range);
+
+  // Replay queue changes in the order they were requested
+  auto dispatch_itr = deferred_dispatches_.begin();
+  for (const auto& record : deferred_records_)
+  {
+    const auto preceding_dispatch_last = std::next(deferred_dispatches_.begin(), record.preceding_dispatch_count);
+    for (; dispatch_itr != preceding_dispatch_last; ++dispatch_itr)
+    {
+      insert_and_limit(std::move(*dispatch_itr));
+    }
+
+    switch (record.operation)
+    {
+    case DeferredOperation::REMOVE:
+      queue_.remove_before(record.stamp);
+      break;
+    case DeferredOperation::ABORT:
+      abort_fn(record.stamp);
+      break;
+    case DeferredOperation::RESET:
+      reset_fn();
+      queue_.clear();
+      break;
+    }
+  }
+
+  for (; dispatch_itr != deferred_dispatches_.end(); ++dispatch_itr)
+  {
+    insert_and_limit(std::move(*dispatch_itr));
+  }
+
+  deferred_dispatches_.clear();
+  deferred_records_.clear();
+  return true;
 }
 
 }  // namespace flow
@@ -0,0 +1,229 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ *
+ * @warning IMPLEMENTATION ONLY: THIS FILE SHOULD NEVER BE INCLUDED DIRECTLY!
+ */
+#ifndef FLOW_IMPL_CONTAINER_RECYCLING_LIST_HPP
+#define FLOW_IMPL_CONTAINER_RECYCLING_LIST_HPP
+
+// C++ Standard Library
+#include <initializer_list>
+#include <iterator>
+#include <new>
+#include <utility>
+
+namespace flow
+{
+
+template <typename T, typename AllocatorT>
+RecyclingList<T, AllocatorT>::RecyclingList(const AllocatorT& allocator) :
+    allocator_{allocator},
+    sentinel_{&sentinel_, &sentinel_}
+{}
+
+
+template <typename T, typename AllocatorT>
+RecyclingList<T, AllocatorT>::RecyclingList(const RecyclingList& other) : RecyclingList{other.get_allocator()}
+{
+  for (const auto& element : other)
+  {
+    emplace_back(element);
+  }
+}
+
+
+template <typename T, typename AllocatorT>
+RecyclingList<T, AllocatorT>::RecyclingList(RecyclingList&& other) : RecyclingList{other.get_allocator()}
+{
+  this->swap(other);
+}
+
+
+template <typename T, typename AllocatorT> RecyclingList<T, AllocatorT>::~RecyclingList() { release(); }
+
+
+template <typename T, typename AllocatorT>
+RecyclingList<T, AllocatorT>& RecyclingList<T, AllocatorT>::operator=(const RecyclingList& other)
+{
+  if (this != std::addressof(other))
+  {
+    // Re-use nodes of current elements
+    this->clear();
+    for (const auto& element : other)
+    {
+      emplace_back(element);
+    }
+  }
+  return *this;
+}
+
+
+template <typename T, typename AllocatorT>
+RecyclingList<T, AllocatorT>& RecyclingList<T, AllocatorT>::operator=(RecyclingList&& other)
+{
+  if (this != std::addressof(other))
+  {
+    this->release();
+    this->swap(other);
+  }
+  return *this;
+}
+
+
+template <typename T, typename AllocatorT> void RecyclingList<T, AllocatorT>::reserve(const size_type capacity)
+{
+  while (this->capacity() < capacity)
+  {
+    recycle(std::allocator_traits<NodeAllocatorType>::allocate(allocator_, 1UL));
+  }
+}
+
+
+template <typename T, typename AllocatorT> void RecyclingList<T, AllocatorT>::shrink_to_fit()
+{
+  while (free_ != nullptr)
+  {
+    Node* const node = static_cast<Node*>(std::exchange(free_, free_->next));
+    std::allocator_traits<NodeAllocatorType>::deallocate(allocator_, node, 1UL);
+  }
+  free_size_ = 0UL;
+}
+
+
+template <typename T, typename AllocatorT>
+template <typename... ArgTs>
+typename RecyclingList<T, AllocatorT>::iterator
+RecyclingList<T, AllocatorT>::emplace(const_iterator pos, ArgTs&&... args)
+{
+  Node* const node = acquire();
+  try
+  {
+    new (node->value()) T(std::forward<ArgTs>(args)...);
+  }
+  catch (...)
+  {
+    recycle(node);
+    throw;
+  }
+  link_before(pos.link_, node);
+  ++size_;
+  return iterator{node};
+}
+
+
+template <typename T, typename AllocatorT>
+typename RecyclingList<T, AllocatorT>::iterator
+RecyclingList<T, AllocatorT>::erase(const_iterator first, const_iterator last)
+{
+  // Detach whole range first, then destroy elements
+  Link* const before = first.link_->prev;
+  before->next = last.link_;
+  last.link_->prev = before;
+
+  while (first != last)
+  {
+    Node* const node = static_cast<Node*>((first++).link_);
+    node->value()->~T();
+    recycle(node);
+    --size_;
+  }
+  return iterator{last.link_};
+}
+
+
+template <typename T, typename AllocatorT>
+void RecyclingList<T, AllocatorT>::splice(
+  const_iterator pos,
+  RecyclingList& other,
+  const_iterator first,
+  const_iterator last)
+{
+  if (first == last)
+  {
+    return;
+  }
+
+  // Counting walks links only; elements are untouched
+  const auto n = static_cast<size_type>(std::distance(first, last));
+
+  // Detach [first, last) from other
+  Link* const head = first.link_;
+  Link* const tail = last.link_->prev;
+  head->prev->next = last.link_;
+  last.link_->prev = head->prev;
+
+  // Attach before pos
+  head->prev = pos.link_->prev;
+  tail->next = pos.link_;
+  pos.link_->prev->next = head;
+  pos.link_->prev = tail;
+
+  other.size_ -= n;
+  size_ += n;
+}
+
+
+template <typename T, typename AllocatorT> void RecyclingList<T, AllocatorT>::swap(RecyclingList& other)
+{
+  using std::swap;
+  swap(allocator_, other.allocator_);
+  swap(sentinel_, other.sentinel_);
+  swap(size_, other.size_);
+  swap(free_, other.free_);
+  swap(free_size_, other.free_size_);
+
+  // Re-point first and last nodes at their new sentinel, or self-link an empty sentinel
+  for (RecyclingList* const list : {this, std::addressof(other)})
+  {
+    if (list->size_ == 0UL)
+    {
+      list->sentinel_.prev = list->sentinel_.next = &list->sentinel_;
+    }
+    else
+    {
+      list->sentinel_.next->prev = list->sentinel_.prev->next = &list->sentinel_;
+    }
+  }
+}
+
+
+template <typename T, typename AllocatorT>
+typename RecyclingList<T, AllocatorT>::Node* RecyclingList<T, AllocatorT>::acquire()
+{
+  if (free_ == nullptr)
+  {
+    return std::allocator_traits<NodeAllocatorType>::allocate(allocator_, 1UL);
+  }
+  --free_size_;
+  return static_cast<Node*>(std::exchange(free_, free_->next));
+}
+
+
+template <typename T, typename AllocatorT> void RecyclingList<T, AllocatorT>::recycle(Node* const node)
+{
+  node->next = free_;
+  free_ = node;
+  ++free_size_;
+}
+
+
+template <typename T, typename AllocatorT>
+void RecyclingList<T, AllocatorT>::link_before(Link* const pos, Link* const node)
+{
+  node->prev = pos->prev;
+  node->next = pos;
+  pos->prev->next = node;
+  pos->prev = node;
+}
+
+
+template <typename T, typename AllocatorT> void RecyclingList<T, AllocatorT>::release()
+{
+  clear();
+  shrink_to_fit();
+}
+
+}  // namespace flow
+
+#endif  // FLOW_IMPL_CONTAINER_RECYCLING_LIST_HPP
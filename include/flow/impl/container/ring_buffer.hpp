@@ -0,0 +1,291 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ *
+ * @warning IMPLEMENTATION ONLY: THIS FILE SHOULD NEVER BE INCLUDED DIRECTLY!
+ */
+#ifndef FLOW_IMPL_CONTAINER_RING_BUFFER_HPP
+#define FLOW_IMPL_CONTAINER_RING_BUFFER_HPP
+
+// C++ Standard Library
+#include <algorithm>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace flow
+{
+
+template <typename T, std::size_t N>
+RingBuffer<T, N>::RingBuffer(const size_type capacity) : StorageType{capacity}
+{}
+
+
+template <typename T, std::size_t N>
+RingBuffer<T, N>::RingBuffer(const RingBuffer& other) : StorageType{other.capacity()}
+{
+  for (const auto& element : other)
+  {
+    emplace_back(element);
+  }
+}
+
+
+template <typename T, std::size_t N> RingBuffer<T, N>::RingBuffer(RingBuffer&& other) : RingBuffer{}
+{
+  this->swap(other);
+}
+
+
+template <typename T, std::size_t N> RingBuffer<T, N>& RingBuffer<T, N>::operator=(const RingBuffer& other)
+{
+  if (this != std::addressof(other))
+  {
+    RingBuffer copy{other};
+    this->swap(copy);
+  }
+  return *this;
+}
+
+
+template <typename T, std::size_t N> RingBuffer<T, N>& RingBuffer<T, N>::operator=(RingBuffer&& other)
+{
+  if (this != std::addressof(other))
+  {
+    this->clear();
+    this->swap(other);
+  }
+  return *this;
+}
+
+
+template <typename T, std::size_t N> void RingBuffer<T, N>::reserve(const size_type capacity)
+{
+  if (capacity <= StorageType::capacity())
+  {
+    return;
+  }
+  else if (!StorageType::is_resizable())
+  {
+    throw std::length_error{"'capacity' exceeds fixed RingBuffer capacity"};
+  }
+  reallocate(capacity);
+}
+
+
+template <typename T, std::size_t N>
+template <typename... ArgTs>
+typename RingBuffer<T, N>::reference RingBuffer<T, N>::emplace_front(ArgTs&&... args)
+{
+  make_room();
+  const size_type new_head = (head_ == 0UL) ? (StorageType::capacity() - 1UL) : (head_ - 1UL);
+  T* const ptr = new (StorageType::slot(new_head)) T(std::forward<ArgTs>(args)...);
+  head_ = new_head;
+  ++size_;
+  return *ptr;
+}
+
+
+template <typename T, std::size_t N>
+template <typename... ArgTs>
+typename RingBuffer<T, N>::reference RingBuffer<T, N>::emplace_back(ArgTs&&... args)
+{
+  make_room();
+  T* const ptr = new (element(size_)) T(std::forward<ArgTs>(args)...);
+  ++size_;
+  return *ptr;
+}
+
+
+template <typename T, std::size_t N>
+template <typename... ArgTs>
+typename RingBuffer<T, N>::iterator RingBuffer<T, N>::emplace(const_iterator pos, ArgTs&&... args)
+{
+  const auto index = static_cast<size_type>(pos.pos_);
+
+  if (index == size_)
+  {
+    emplace_back(std::forward<ArgTs>(args)...);
+    return iterator{this, pos.pos_};
+  }
+  else if (index == 0UL)
+  {
+    emplace_front(std::forward<ArgTs>(args)...);
+    return begin();
+  }
+
+  // Construct before shifting, since arguments may refer to existing elements
+  T value(std::forward<ArgTs>(args)...);
+
+  // Make room before shifting, since growing storage would invalidate element references
+  make_room();
+
+  if (index < (size_ / 2UL))
+  {
+    // Shift elements before insertion point towards the front
+    emplace_front(std::move(front()));
+    for (size_type i = 1UL; i < index; ++i)
+    {
+      (*this)[i] = std::move((*this)[i + 1UL]);
+    }
+  }
+  else
+  {
+    // Shift elements at and after insertion point towards the back
+    emplace_back(std::move(back()));
+    for (size_type i = size_ - 2UL; i > index; --i)
+    {
+      (*this)[i] = std::move((*this)[i - 1UL]);
+    }
+  }
+
+  (*this)[index] = std::move(value);
+  return iterator{this, pos.pos_};
+}
+
+
+template <typename T, std::size_t N> void RingBuffer<T, N>::pop_front()
+{
+  element(0UL)->~T();
+  head_ = wrap(head_ + 1UL);
+  --size_;
+}
+
+
+template <typename T, std::size_t N> void RingBuffer<T, N>::pop_back()
+{
+  element(size_ - 1UL)->~T();
+  --size_;
+}
+
+
+template <typename T, std::size_t N>
+typename RingBuffer<T, N>::iterator RingBuffer<T, N>::erase(const_iterator first, const_iterator last)
+{
+  const auto first_index = static_cast<size_type>(first.pos_);
+  const auto last_index = static_cast<size_type>(last.pos_);
+  const size_type count = last_index - first_index;
+
+  if (count == 0UL)
+  {
+    return iterator{this, first.pos_};
+  }
+  else if (first_index == 0UL)
+  {
+    // Drop prefix
+    destroy(0UL, last_index);
+    head_ = wrap(head_ + count);
+    size_ -= count;
+  }
+  else if (last_index == size_)
+  {
+    // Drop suffix
+    destroy(first_index, last_index);
+    size_ -= count;
+  }
+  else if (first_index < (size_ - last_index))
+  {
+    // Shift elements before the range towards the back
+    for (size_type i = first_index; i > 0UL; --i)
+    {
+      (*this)[i - 1UL + count] = std::move((*this)[i - 1UL]);
+    }
+    destroy(0UL, count);
+    head_ = wrap(head_ + count);
+    size_ -= count;
+  }
+  else
+  {
+    // Shift elements after the range towards the front
+    for (size_type i = last_index; i < size_; ++i)
+    {
+      (*this)[i - count] = std::move((*this)[i]);
+    }
+    destroy(size_ - count, size_);
+    size_ -= count;
+  }
+  return iterator{this, first.pos_};
+}
+
+
+template <typename T, std::size_t N> void RingBuffer<T, N>::clear()
+{
+  destroy(0UL, size_);
+  head_ = 0UL;
+  size_ = 0UL;
+}
+
+
+template <typename T, std::size_t N> void RingBuffer<T, N>::swap(RingBuffer& other)
+{
+  swap_storage(other, std::integral_constant<bool, StorageType::is_resizable()>{});
+}
+
+
+template <typename T, std::size_t N>
+void RingBuffer<T, N>::swap_storage(RingBuffer& other, std::true_type /*resizable*/)
+{
+  StorageType::swap(other);
+  std::swap(head_, other.head_);
+  std::swap(size_, other.size_);
+}
+
+
+template <typename T, std::size_t N>
+void RingBuffer<T, N>::swap_storage(RingBuffer& other, std::false_type /*resizable*/)
+{
+  // In-place storage; elements must be exchanged individually
+  RingBuffer& smaller = (size_ <= other.size_) ? *this : other;
+  RingBuffer& larger = (size_ <= other.size_) ? other : *this;
+
+  const size_type common_size = smaller.size_;
+  for (size_type i = 0UL; i < common_size; ++i)
+  {
+    std::swap(smaller[i], larger[i]);
+  }
+
+  for (size_type i = common_size; i < larger.size_; ++i)
+  {
+    smaller.emplace_back(std::move(larger[i]));
+  }
+  larger.erase(std::next(larger.cbegin(), common_size), larger.cend());
+}
+
+
+template <typename T, std::size_t N> void RingBuffer<T, N>::make_room()
+{
+  if (size_ < StorageType::capacity())
+  {
+    return;
+  }
+  else if (!StorageType::is_resizable())
+  {
+    throw std::length_error{"RingBuffer is full"};
+  }
+  reallocate(std::max<size_type>(2UL * StorageType::capacity(), 16UL));
+}
+
+
+template <typename T, std::size_t N> void RingBuffer<T, N>::reallocate(const size_type capacity)
+{
+  RingBuffer resized{capacity};
+  for (auto& element : *this)
+  {
+    resized.emplace_back(std::move(element));
+  }
+  this->clear();
+  this->swap(resized);
+}
+
+
+template <typename T, std::size_t N> void RingBuffer<T, N>::destroy(const size_type first, const size_type last)
+{
+  for (size_type i = first; i < last; ++i)
+  {
+    element(i)->~T();
+  }
+}
+
+}  // namespace flow
+
+#endif  // FLOW_IMPL_CONTAINER_RING_BUFFER_HPP
@@ -0,0 +1,76 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ *
+ * @warning IMPLEMENTATION ONLY: THIS FILE SHOULD NEVER BE INCLUDED DIRECTLY!
+ */
+#ifndef FLOW_IMPL_CONTAINER_STAMP_INDEXED_HPP
+#define FLOW_IMPL_CONTAINER_STAMP_INDEXED_HPP
+
+namespace flow
+{
+namespace detail
+{
+
+template <typename StampT> void StampIndex<StampT>::emplace_front(const key_type& key)
+{
+  if (head_ > 0UL)
+  {
+    keys_[--head_] = key;
+  }
+  else
+  {
+    keys_.emplace(keys_.begin(), key);
+  }
+}
+
+
+template <typename StampT> void StampIndex<StampT>::pop_front(const size_type n)
+{
+  head_ += n;
+
+  if (head_ == keys_.size())
+  {
+    clear();
+  }
+  else if (head_ > (keys_.size() - head_))
+  {
+    keys_.erase(keys_.begin(), keys_.begin() + head_);
+    head_ = 0UL;
+  }
+}
+
+
+template <typename StampT>
+typename StampIndex<StampT>::size_type StampIndex<StampT>::lower_bound(const size_type first, const StampT& stamp) const
+{
+  return first + stamp_lower_bound(keys_.data() + head_ + first, size() - first, to_key(stamp));
+}
+
+
+template <typename StampT>
+typename StampIndex<StampT>::size_type StampIndex<StampT>::upper_bound(const size_type first, const StampT& stamp) const
+{
+  return first + stamp_upper_bound(keys_.data() + head_ + first, size() - first, to_key(stamp));
+}
+
+
+template <typename StampT>
+typename StampIndex<StampT>::size_type
+StampIndex<StampT>::lower_bound_from_front(const size_type first, const StampT& stamp) const
+{
+  return first + stamp_lower_bound_from_front(keys_.data() + head_ + first, size() - first, to_key(stamp));
+}
+
+
+template <typename StampT>
+typename StampIndex<StampT>::size_type
+StampIndex<StampT>::upper_bound_from_front(const size_type first, const StampT& stamp) const
+{
+  return first + stamp_upper_bound_from_front(keys_.data() + head_ + first, size() - first, to_key(stamp));
+}
+
+}  // namespace detail
+}  // namespace flow
+
+#endif  // FLOW_IMPL_CONTAINER_STAMP_INDEXED_HPP
@@ -9,14 +9,156 @@
 
 // C++ Standard Library
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <iterator>
 
 namespace flow
 {
+namespace detail
+{
+
+/**
+ * @brief Finds first element in a partitioned range for which \c pred is false, using binary search
+ */
+template <typename IteratorT, typename UnaryPredicateT>
+inline IteratorT partition_point(IteratorT first, IteratorT last, UnaryPredicateT pred, std::random_access_iterator_tag)
+{
+  return std::partition_point(first, last, pred);
+}
+
+/**
+ * @brief Finds first element in a partitioned range for which \c pred is false, using linear search
+ *
+ * @note Linear search is used when iterators are not random-access, since advancing iterators is itself linear
+ */
+template <typename IteratorT, typename UnaryPredicateT>
+inline IteratorT partition_point(IteratorT first, IteratorT last, UnaryPredicateT pred, std::input_iterator_tag)
+{
+  return std::find_if_not(first, last, pred);
+}
+
+/**
+ * @brief Finds first element in a partitioned range for which \c pred is false, galloping forwards from \c first
+ *
+ * Brackets the partition point with exponentially growing steps from \c first, then uses binary search within that
+ * bracket, such that cost scales with the distance of the partition point from \c first
+ */
+template <typename IteratorT, typename UnaryPredicateT>
+inline IteratorT
+partition_point_from_front(IteratorT first, IteratorT last, UnaryPredicateT pred, std::random_access_iterator_tag)
+{
+  typename std::iterator_traits<IteratorT>::difference_type step = 1;
+  while ((last - first) > step)
+  {
+    const auto probe = first + (step - 1);
+    if (!pred(*probe))
+    {
+      return std::partition_point(first, probe, pred);
+    }
+    first = std::next(probe);
+    step *= 2;
+  }
+  return std::partition_point(first, last, pred);
+}
+
+/**
+ * @brief Finds first element in a partitioned range for which \c pred is false, walking forwards from \c first
+ */
+template <typename IteratorT, typename UnaryPredicateT>
+inline IteratorT
+partition_point_from_front(IteratorT first, IteratorT last, UnaryPredicateT pred, std::input_iterator_tag)
+{
+  return std::find_if_not(first, last, pred);
+}
+
+/**
+ * @brief Finds first element in a partitioned range for which \c pred is false, galloping backwards from \c last
+ *
+ * Brackets the partition point with exponentially growing steps from \c last, then uses binary search within that
+ * bracket, such that cost scales with the distance of the partition point from \c last
+ */
+template <typename IteratorT, typename UnaryPredicateT>
+inline IteratorT
+partition_point_from_back(IteratorT first, IteratorT last, UnaryPredicateT pred, std::random_access_iterator_tag)
+{
+  typename std::iterator_traits<IteratorT>::difference_type step = 1;
+  while ((last - first) > step)
+  {
+    const auto probe = last - step;
+    if (pred(*probe))
+    {
+      return std::partition_point(std::next(probe), last, pred);
+    }
+    last = probe;
+    step *= 2;
+  }
+  return std::partition_point(first, last, pred);
+}
+
+/**
+ * @brief Finds first element in a partitioned range for which \c pred is false, walking backwards from \c last
+ */
+template <typename IteratorT, typename UnaryPredicateT>
+inline IteratorT
+partition_point_from_back(IteratorT first, IteratorT last, UnaryPredicateT pred, std::bidirectional_iterator_tag)
+{
+  while (last != first and !pred(*std::prev(last)))
+  {
+    --last;
+  }
+  return last;
+}
+
+/**
+ * @brief Returns the number of elements in <code>[first, last)</code>, counting no more than \c n
+ */
+template <typename IteratorT> inline std::size_t bounded_distance(IteratorT first, const IteratorT last, std::size_t n)
+{
+  std::size_t count = 0UL;
+  for (; count < n and first != last; ++first)
+  {
+    ++count;
+  }
+  return count;
+}
+
+/**
+ * @brief Removes the first \c n elements of \c container, returning an updated iterator to \c pos
+ *
+ * Iterators may be position-based (e.g. RingBuffer), so \c pos is re-derived from its offset after erasure
+ *
+ * @warning \c pos must not be one of the first \c n elements
+ */
+template <typename ContainerT, typename IteratorT>
+inline IteratorT
+erase_first_n(ContainerT& container, const IteratorT pos, const std::size_t n, std::random_access_iterator_tag)
+{
+  const auto offset = std::distance(container.begin(), pos) - static_cast<std::ptrdiff_t>(n);
+  container.erase(container.begin(), std::next(container.begin(), n));
+  return std::next(container.begin(), offset);
+}
+
+/**
+ * @copydoc erase_first_n
+ *
+ * @note Iterators of node-based containers are not invalidated by erasing other elements
+ */
+template <typename ContainerT, typename IteratorT>
+inline IteratorT
+erase_first_n(ContainerT& container, const IteratorT pos, const std::size_t n, std::bidirectional_iterator_tag)
+{
+  container.erase(container.begin(), std::next(container.begin(), n));
+  return pos;
+}
+
+}  // namespace detail
+
 
 template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
 DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::DispatchQueue(const ContainerT& container) :
-    container_{container}
+    container_{container},
+    index_{container_.begin(), container_.end(), AccessStampT{}}
 {}
 
 
@@ -54,6 +196,7 @@ OutputDispatchIteratorT DispatchQueue<DispatchT, ContainerT, AccessStampT, Acces
   OutputDispatchIteratorT output,
   const ExtractionRange& extraction_range)
 {
+  ++generation_;
   return std::move(
     std::next(container_.begin(), extraction_range.first),
     std::next(container_.begin(), extraction_range.last),
@@ -61,47 +204,441 @@ OutputDispatchIteratorT DispatchQueue<DispatchT, ContainerT, AccessStampT, Acces
 }
 
 
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+template <typename OutputDispatchIteratorT>
+OutputDispatchIteratorT DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::extract_first_n(
+  OutputDispatchIteratorT output,
+  const size_type n)
+{
+  output = std::move(container_.begin(), std::next(container_.begin(), n), output);
+  remove_first_n(n);
+  return output;
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+SpliceInserter<ContainerT> DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::extract_first_n(
+  SpliceInserter<ContainerT> output,
+  const size_type n)
+{
+  ++generation_;
+  auto& destination = output.container();
+  destination.splice(destination.cend(), container_, container_.cbegin(), std::next(container_.cbegin(), n));
+  index_.pop_front(n);
+  front_position_ += n;
+  return output;
+}
+
+
 template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
 template <typename... DispatchConstructorArgTs>
 void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::insert(
   DispatchConstructorArgTs&&... dispatch_args)
 {
-  DispatchT dispatch{std::forward<DispatchConstructorArgTs>(dispatch_args)...};
+  insert_impl(DispatchT{std::forward<DispatchConstructorArgTs>(dispatch_args)...}, 0UL, HasStampIndex{});
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+template <typename... DispatchConstructorArgTs>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::size_type
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::insert_and_limit(
+  const size_type capacity,
+  DispatchConstructorArgTs&&... dispatch_args)
+{
+  return insert_impl(DispatchT{std::forward<DispatchConstructorArgTs>(dispatch_args)...}, capacity, HasStampIndex{});
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::insert(DispatchT&& dispatch)
+{
+  insert_impl(std::move(dispatch), 0UL, HasStampIndex{});
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::size_type
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::insert_and_limit(
+  const size_type capacity,
+  DispatchT&& dispatch)
+{
+  return insert_impl(std::move(dispatch), capacity, HasStampIndex{});
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::size_type
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::insert_impl(
+  DispatchT&& dispatch,
+  const size_type capacity,
+  std::false_type)
+{
+  ++generation_;
+  const stamp_type stamp = AccessStamp::get(dispatch);
+
+  // Number of elements to remove to make room for the new element
+  const size_type n_drop = (capacity and container_.size() >= capacity) ? (container_.size() - capacity + 1UL) : 0UL;
 
   // If data to add is ordered with respect to current queue,
   // add to back (as newest element)
-  if (container_.empty() or (AccessStamp::get(container_.back()) < AccessStamp::get(dispatch)))
+  if (container_.empty() or (AccessStamp::get(container_.back()) < stamp))
   {
+    remove_first_n(n_drop);
     container_.emplace_back(std::move(dispatch));
-    return;
+    record_insertion(0UL);
+    return n_drop;
   }
 
-  // Find next best placement
-  auto qitr = container_.end();
-  while (AccessStamp::get(*(--qitr)) > AccessStamp::get(dispatch))
+  // Find next best placement, after all elements with stamps at or before the new element
+  auto qitr = detail::partition_point_from_back(
+    container_.begin(),
+    container_.end(),
+    [&stamp](const DispatchT& queued) { return !(stamp < AccessStamp::get(queued)); },
+    typename std::iterator_traits<typename ContainerT::iterator>::iterator_category{});
+
+  // Number of queued elements newer than the new element
+  const auto depth = static_cast<size_type>(std::distance(qitr, container_.end()));
+
+  // Insert only if this element does not duplicate an existing element
+  if (qitr != container_.begin() and AccessStamp::get(*std::prev(qitr)) == stamp)
+  {
+    return 0UL;
+  }
+  else if (n_drop)
   {
-    if (qitr == container_.begin())
+    // Drop new element, along with the oldest elements, if it would not be among the newest elements
+    if (detail::bounded_distance(container_.begin(), qitr, n_drop) < n_drop)
     {
-      container_.emplace_front(std::move(dispatch));
-      return;
+      remove_first_n(n_drop - 1UL);
+      return n_drop;
+    }
+    qitr = detail::erase_first_n(
+      container_, qitr, n_drop, typename std::iterator_traits<typename ContainerT::iterator>::iterator_category{});
+    front_position_ += n_drop;
+  }
+
+  if (qitr == container_.begin())
+  {
+    container_.emplace_front(std::move(dispatch));
+  }
+  else
+  {
+    container_.emplace(qitr, std::move(dispatch));
+  }
+  record_insertion(depth);
+  return n_drop;
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::size_type
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::insert_impl(
+  DispatchT&& dispatch,
+  const size_type capacity,
+  std::true_type)
+{
+  ++generation_;
+  const auto key = StampIndexType::to_key(AccessStamp::get(dispatch));
+
+  // Number of elements to remove to make room for the new element
+  const size_type n_drop = (capacity and container_.size() >= capacity) ? (container_.size() - capacity + 1UL) : 0UL;
+
+  // If data to add is ordered with respect to current queue,
+  // add to back (as newest element)
+  if (container_.empty() or (index_.back() < key))
+  {
+    remove_first_n(n_drop);
+
+    // Index is updated first, and restored if the container rejects the element, so that both stay in lockstep
+    index_.emplace_back(key);
+    try
+    {
+      container_.emplace_back(std::move(dispatch));
     }
+    catch (...)
+    {
+      index_.pop_back(1UL);
+      throw;
+    }
+    record_insertion(0UL);
+    return n_drop;
   }
 
+  // Find next best placement, after all elements with stamps at or before the new element
+  size_type pos = index_.upper_bound_from_back(key);
+
+  // Number of queued elements newer than the new element
+  const size_type depth = index_.size() - pos;
+
   // Insert only if this element does not duplicate an existing element
-  if (AccessStamp::get(*qitr) != AccessStamp::get(dispatch))
+  if (pos > 0UL and index_[pos - 1UL] == key)
   {
-    container_.emplace(std::next(qitr), std::move(dispatch));
+    return 0UL;
+  }
+  else if (n_drop)
+  {
+    // Drop new element, along with the oldest elements, if it would not be among the newest elements
+    if (pos < n_drop)
+    {
+      remove_first_n(n_drop - 1UL);
+      return n_drop;
+    }
+    remove_first_n(n_drop);
+    pos -= n_drop;
+  }
+
+  if (pos == 0UL)
+  {
+    index_.emplace_front(key);
+    try
+    {
+      container_.emplace_front(std::move(dispatch));
+    }
+    catch (...)
+    {
+      index_.pop_front(1UL);
+      throw;
+    }
+  }
+  else
+  {
+    index_.emplace(pos, key);
+    try
+    {
+      container_.emplace(std::next(container_.begin(), pos), std::move(dispatch));
+    }
+    catch (...)
+    {
+      index_.erase(pos);
+      throw;
+    }
+  }
+  record_insertion(depth);
+  return n_drop;
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::record_insertion(const size_type depth)
+{
+  if (depth == 0UL)
+  {
+    ++insertion_stats_.in_order;
+  }
+  else
+  {
+    ++insertion_stats_.out_of_order;
+    insertion_stats_.total_depth += depth;
+    insertion_stats_.max_depth = std::max<std::size_t>(insertion_stats_.max_depth, depth);
   }
 }
 
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+template <typename ForwardDispatchIteratorT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::size_type
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::merge(
+  ForwardDispatchIteratorT first,
+  const ForwardDispatchIteratorT last,
+  const size_type capacity)
+{
+  // Place each element from the back, as insert_and_limit does; queued elements are never moved out of the queue, so
+  // nothing which was already queued is lost if placing an element throws
+  size_type removed = 0UL;
+  for (; first != last; ++first)
+  {
+    removed += insert_impl(DispatchT{*first}, capacity, HasStampIndex{});
+  }
+  return removed;
+}
+
+
 template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
 typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
-DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::before(stamp_const_arg_type stamp) const
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::lower_bound(
+  const_iterator first,
+  stamp_const_arg_type stamp) const
+{
+  return lower_bound_impl(first, stamp, HasStampIndex{});
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::lower_bound_impl(
+  const_iterator first,
+  stamp_const_arg_type stamp,
+  std::false_type) const
+{
+  return detail::partition_point(
+    first,
+    container_.end(),
+    [stamp](const DispatchT& dispatch) { return AccessStamp::get(dispatch) < stamp; },
+    typename std::iterator_traits<const_iterator>::iterator_category{});
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::lower_bound_impl(
+  const_iterator first,
+  stamp_const_arg_type stamp,
+  std::true_type) const
+{
+  const auto offset = static_cast<size_type>(std::distance(container_.begin(), first));
+  return std::next(container_.begin(), index_.lower_bound(offset, stamp));
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::upper_bound(
+  const_iterator first,
+  stamp_const_arg_type stamp) const
+{
+  return upper_bound_impl(first, stamp, HasStampIndex{});
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::upper_bound_impl(
+  const_iterator first,
+  stamp_const_arg_type stamp,
+  std::false_type) const
+{
+  return detail::partition_point(
+    first,
+    container_.end(),
+    [stamp](const DispatchT& dispatch) { return AccessStamp::get(dispatch) <= stamp; },
+    typename std::iterator_traits<const_iterator>::iterator_category{});
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::upper_bound_impl(
+  const_iterator first,
+  stamp_const_arg_type stamp,
+  std::true_type) const
+{
+  const auto offset = static_cast<size_type>(std::distance(container_.begin(), first));
+  return std::next(container_.begin(), index_.upper_bound(offset, stamp));
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::lower_bound(
+  SearchCursor<stamp_type>& cursor,
+  stamp_const_arg_type stamp) const
+{
+  size_type pos = resume_position(cursor, stamp);
+  const auto itr = lower_bound_from_front(pos, stamp, HasStampIndex{});
+  cursor.position = front_position_ + pos;
+  cursor.stamp = stamp;
+  cursor.valid = true;
+  return itr;
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::upper_bound(
+  SearchCursor<stamp_type>& cursor,
+  stamp_const_arg_type stamp) const
 {
-  const auto after_itr = std::find_if(container_.begin(), container_.end(), [stamp](const DispatchT& dispatch) {
-    return AccessStamp::get(dispatch) >= stamp;
-  });
+  size_type pos = resume_position(cursor, stamp);
+  const auto itr = upper_bound_from_front(pos, stamp, HasStampIndex{});
+  cursor.position = front_position_ + pos;
+  cursor.stamp = stamp;
+  cursor.valid = true;
+  return itr;
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::size_type
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::resume_position(
+  const SearchCursor<stamp_type>& cursor,
+  stamp_const_arg_type stamp) const
+{
+  // Elements before the cursor were all before the previous search stamp, so are also before a later stamp
+  if (!cursor.valid or stamp < cursor.stamp or cursor.position <= front_position_)
+  {
+    return 0UL;
+  }
+
+  // Cursor may be past the newest element if newer elements were dropped
+  return static_cast<size_type>(std::min<std::uint64_t>(cursor.position - front_position_, container_.size()));
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::lower_bound_from_front(
+  size_type& pos,
+  stamp_const_arg_type stamp,
+  std::false_type) const
+{
+  const auto first = std::next(container_.begin(), pos);
+  const auto itr = detail::partition_point_from_front(
+    first,
+    container_.end(),
+    [stamp](const DispatchT& dispatch) { return AccessStamp::get(dispatch) < stamp; },
+    typename std::iterator_traits<const_iterator>::iterator_category{});
+  pos += static_cast<size_type>(std::distance(first, itr));
+  return itr;
+}
 
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::lower_bound_from_front(
+  size_type& pos,
+  stamp_const_arg_type stamp,
+  std::true_type) const
+{
+  pos = index_.lower_bound_from_front(pos, stamp);
+  return std::next(container_.begin(), pos);
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::upper_bound_from_front(
+  size_type& pos,
+  stamp_const_arg_type stamp,
+  std::false_type) const
+{
+  const auto first = std::next(container_.begin(), pos);
+  const auto itr = detail::partition_point_from_front(
+    first,
+    container_.end(),
+    [stamp](const DispatchT& dispatch) { return AccessStamp::get(dispatch) <= stamp; },
+    typename std::iterator_traits<const_iterator>::iterator_category{});
+  pos += static_cast<size_type>(std::distance(first, itr));
+  return itr;
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::upper_bound_from_front(
+  size_type& pos,
+  stamp_const_arg_type stamp,
+  std::true_type) const
+{
+  pos = index_.upper_bound_from_front(pos, stamp);
+  return std::next(container_.begin(), pos);
+}
+
+
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_iterator
+DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::before(stamp_const_arg_type stamp) const
+{
+  const auto after_itr = this->lower_bound(stamp);
   return after_itr == this->end() ? after_itr : std::prev(after_itr);
 }
 
@@ -110,9 +647,7 @@ template <typename DispatchT, typename ContainerT, typename AccessStampT, typena
 typename DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::const_reverse_iterator
 DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::rbefore(stamp_const_arg_type stamp) const
 {
-  return std::find_if(container_.rbegin(), container_.rend(), [stamp](const DispatchT& dispatch) {
-    return AccessStamp::get(dispatch) < stamp;
-  });
+  return const_reverse_iterator{this->lower_bound(stamp)};
 }
 
 
@@ -134,33 +669,33 @@ template <typename DispatchT, typename ContainerT, typename AccessStampT, typena
 void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::pop()
 {
   container_.pop_front();
+  index_.pop_front(1UL);
+  ++front_position_;
+  ++generation_;
 }
 
 
 template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
 void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::clear()
 {
+  front_position_ += container_.size();
+  ++generation_;
   container_.clear();
+  index_.clear();
 }
 
 
 template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
 void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::remove_before(stamp_const_arg_type t)
 {
-  while (!container_.empty() and AccessStamp::get(container_.front()) < t)
-  {
-    container_.pop_front();
-  }
+  erase_front(this->lower_bound(t));
 }
 
 
 template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
 void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::remove_at_before(stamp_const_arg_type t)
 {
-  while (!container_.empty() and AccessStamp::get(container_.front()) <= t)
-  {
-    container_.pop_front();
-  }
+  erase_front(this->upper_bound(t));
 }
 
 
@@ -168,19 +703,33 @@ template <typename DispatchT, typename ContainerT, typename AccessStampT, typena
 void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::remove_first_n(const size_type n)
 {
   container_.erase(container_.begin(), std::next(container_.begin(), n));
+  index_.pop_front(n);
+  front_position_ += n;
+  ++generation_;
 }
 
 
 template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
 void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::shrink_to_fit(const size_type n)
 {
-  while (container_.size() > n)
+  if (container_.size() > n)
   {
-    container_.pop_front();
+    remove_first_n(container_.size() - n);
   }
 }
 
 
+template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
+void DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::erase_front(const const_iterator last)
+{
+  const auto n = static_cast<size_type>(std::distance(container_.cbegin(), last));
+  container_.erase(container_.cbegin(), last);
+  index_.pop_front(n);
+  front_position_ += n;
+  ++generation_;
+}
+
+
 template <typename DispatchT, typename ContainerT, typename AccessStampT, typename AccessValueT>
 const ContainerT& DispatchQueue<DispatchT, ContainerT, AccessStampT, AccessValueT>::get_container() const noexcept
 {
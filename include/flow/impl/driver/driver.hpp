@@ -55,6 +55,21 @@ template <typename PolicyT> void Driver<PolicyT>::abort_policy_impl(const stamp_
 
 template <typename PolicyT> void Driver<PolicyT>::reset_policy_impl() { derived()->reset_driver_impl(); }
 
+
+template <typename PolicyT>
+WakeThreshold<typename Driver<PolicyT>::stamp_type>
+Driver<PolicyT>::wake_threshold_policy_impl(const CaptureRange<stamp_type>& range) const
+{
+  return derived()->wake_threshold_driver_impl();
+}
+
+
+template <typename PolicyT>
+std::size_t Driver<PolicyT>::extract_size_policy_impl(const ExtractionRange& extraction_range) const
+{
+  return derived()->extract_size_driver_impl(extraction_range);
+}
+
 }  // namespace flow
 
 #endif  // FLOW_IMPL_DRIVER_DRIVER_HPP
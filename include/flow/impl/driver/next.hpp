@@ -62,8 +62,7 @@ void Next<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, Acces
   const ExtractionRange& extraction_range,
   const CaptureRange<stamp_type>& range)
 {
-  output = PolicyType::queue_.move(output, extraction_range);
-  PolicyType::queue_.remove_first_n(extraction_range.last);
+  output = PolicyType::queue_.extract_first_n(output, extraction_range.last);
 }
 
 
@@ -0,0 +1,242 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ *
+ * @warning IMPLEMENTATION ONLY: THIS FILE SHOULD NEVER BE INCLUDED DIRECTLY!
+ */
+#ifndef FLOW_IMPL_EVENT_SYNCHRONIZER_HPP
+#define FLOW_IMPL_EVENT_SYNCHRONIZER_HPP
+
+// C++ Standard Library
+#include <array>
+#include <iterator>
+#include <tuple>
+#include <utility>
+
+// Flow
+#include <flow/utility/apply.hpp>
+#include <flow/utility/static_assert.hpp>
+
+namespace flow
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/// captor::set_group_notifier call helper, which attaches each captor to its own notifier
+class NotifierAttachHelper
+{
+public:
+  explicit NotifierAttachHelper(const bool attach) : attach_{attach} {}
+
+  template <typename CaptorT, typename LockPolicyT, typename QueueMonitorT>
+  inline void operator()(Captor<CaptorT, LockPolicyT, QueueMonitorT>& c, GroupNotifier& group_notifier)
+  {
+    c.set_group_notifier(attach_ ? std::addressof(group_notifier) : nullptr);
+  }
+
+private:
+  /// Attach if true; otherwise, detach
+  bool attach_;
+};
+
+
+/// Reserves frame buffer capacity for the number of located elements
+struct FrameReserveHelper
+{
+  template <typename BufferT> inline void operator()(BufferT& buffer, const std::size_t size) { buffer.reserve(size); }
+};
+
+
+/// Creates a frame buffer output iterator
+struct FrameOutputHelper
+{
+  template <typename BufferT> inline std::back_insert_iterator<BufferT> operator()(BufferT& buffer)
+  {
+    return std::back_inserter(buffer);
+  }
+};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+
+template <typename... CaptorTs>
+EventSynchronizer<CaptorTs...>::EventSynchronizer(frame_callback_type frame_callback, CaptorTs&... captors) :
+    EventSynchronizer{std::move(frame_callback), executor_type{}, captors...}
+{}
+
+
+template <typename... CaptorTs>
+EventSynchronizer<CaptorTs...>::EventSynchronizer(
+  frame_callback_type frame_callback,
+  executor_type executor,
+  CaptorTs&... captors) :
+    captors_{captors...},
+    frame_callback_{std::move(frame_callback)},
+    executor_{std::move(executor)},
+    blocking_index_{N_CAPTORS},
+    requests_{0UL},
+    capturing_{false}
+{
+  // Sanity check captor sequence
+  FLOW_STATIC_ASSERT(
+    detail::captor_sequence_valid<CaptorTupleType>(),
+    "[EventSynchronizer] Captor sequence is invalid. Must have (DriverType, FollowerTypes...) with "
+    "0 or more FollowerTypes allowed.");
+
+  // Sanity check captor stamp types
+  FLOW_STATIC_ASSERT(
+    detail::captor_stamp_types_consistent<CaptorTupleType>(),
+    "[EventSynchronizer] Associated captor stamp types do not match between all captors");
+
+  for (std::size_t captor_index = 0; captor_index < N_CAPTORS; ++captor_index)
+  {
+    notifiers_[captor_index].set_callback([this, captor_index] { this->on_change(captor_index); });
+  }
+  apply_every(detail::NotifierAttachHelper{true}, captors_, notifiers_);
+
+  // Capture frames which were ready before captors were attached
+  poll();
+}
+
+
+template <typename... CaptorTs> EventSynchronizer<CaptorTs...>::~EventSynchronizer()
+{
+  apply_every(detail::NotifierAttachHelper{false}, captors_, notifiers_);
+}
+
+
+template <typename... CaptorTs> void EventSynchronizer<CaptorTs...>::poll()
+{
+  blocking_index_.store(N_CAPTORS);
+  request();
+}
+
+
+template <typename... CaptorTs> void EventSynchronizer<CaptorTs...>::on_change(const std::size_t captor_index)
+{
+  // Changes to captors other than the one which ended the last attempt cannot make a frame ready
+  const std::size_t blocking_index = blocking_index_.load();
+  if (blocking_index == N_CAPTORS or blocking_index == captor_index)
+  {
+    request();
+  }
+}
+
+
+template <typename... CaptorTs> void EventSynchronizer<CaptorTs...>::request()
+{
+  requests_.fetch_add(1UL);
+
+  // Only one thread captures at a time; requests made while it does are picked up by its next pass, including
+  // requests made from inline frame callbacks
+  while (!capturing_.exchange(true))
+  {
+    const auto observed_requests = requests_.load();
+    try
+    {
+      capture_ready();
+    }
+    catch (...)
+    {
+      capturing_.store(false);
+      throw;
+    }
+    capturing_.store(false);
+
+    // A request made after the last pass started may have been left to this thread
+    if (requests_.load() == observed_requests)
+    {
+      return;
+    }
+  }
+}
+
+
+template <typename... CaptorTs> void EventSynchronizer<CaptorTs...>::capture_ready()
+{
+  // Accept changes to any captor until the blocking captor is known again
+  blocking_index_.store(N_CAPTORS);
+
+  // Frames left behind by a callback which threw are discarded
+  ready_frames_.clear();
+
+  // Lock all captors once for every ready frame; locks are released on scope exit if extraction throws
+  auto locks = apply_every_r(detail::DeferLockHelper{}, captors_);
+  detail::lock_all(locks, make_index_sequence<N_CAPTORS>{});
+
+  while (true)
+  {
+    result_type result{};
+    std::array<ExtractionRange, N_CAPTORS> elements;
+    detail::LockedLocateHelper<result_type, stamp_type> locate_helper{result, StampTraits<stamp_type>::min()};
+    apply_every(locate_helper, captors_, elements);
+
+    if (result.state == State::RETRY)
+    {
+      blocking_index_.store(locate_helper.ready_count());
+      break;
+    }
+
+    const bool primed = (result.state == State::PRIMED);
+
+    // Size frame buffers exactly before extracting into them
+    frame_type frame;
+    if (primed)
+    {
+      std::array<std::size_t, N_CAPTORS> sizes;
+      apply_every(detail::ExtractSizeHelper{}, captors_, elements, sizes);
+      apply_every(detail::FrameReserveHelper{}, frame, sizes);
+    }
+
+    std::array<std::uint64_t, N_CAPTORS> generations_before;
+    apply_every(detail::GenerationHelper{}, captors_, generations_before);
+    apply_every_r(
+      detail::LockedExtractHelper<result_type>{result},
+      captors_,
+      apply_every_r(detail::FrameOutputHelper{}, frame),
+      elements);
+
+    if (primed)
+    {
+      ready_frames_.emplace_back(result, std::move(frame));
+      continue;
+    }
+
+    // Frame was dropped; stop once dropping it no longer changes any captor, or it would be located again
+    std::array<std::uint64_t, N_CAPTORS> generations_after;
+    apply_every(detail::GenerationHelper{}, captors_, generations_after);
+    if (generations_before == generations_after)
+    {
+      break;
+    }
+  }
+
+  detail::unlock_all_reversed(locks, make_index_sequence<N_CAPTORS>{});
+
+  // Invoke callbacks only after all captor locks have been released
+  for (auto& ready_frame : ready_frames_)
+  {
+    dispatch(ready_frame.first, std::move(ready_frame.second));
+  }
+  ready_frames_.clear();
+}
+
+
+template <typename... CaptorTs>
+void EventSynchronizer<CaptorTs...>::dispatch(const result_type& result, frame_type&& frame)
+{
+  if (executor_)
+  {
+    executor_([this, result, frame = std::move(frame)]() mutable { frame_callback_(result, std::move(frame)); });
+  }
+  else
+  {
+    frame_callback_(result, std::move(frame));
+  }
+}
+
+}  // namespace flow
+
+#endif  // FLOW_IMPL_EVENT_SYNCHRONIZER_HPP
@@ -48,14 +48,9 @@ AnyAtOrBefore<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, A
   // The boundary before which messages are valid and after which they are not. Non-inclusive.
   const stamp_type boundary = range.upper_stamp - delay_;
 
-  auto itr = PolicyType::queue_.begin();
-
-  // Collect all the messages that are earlier than the first driving message's
+  // Collect all the messages that are at or earlier than the first driving message's
   // timestamp minus the delay
-  while (itr != PolicyType::queue_.end() and AccessStampT::get(*itr) <= boundary)
-  {
-    ++itr;
-  }
+  const auto itr = PolicyType::queue_.upper_bound(cursor_, boundary);
 
   return std::make_tuple(
     State::PRIMED, ExtractionRange{0, static_cast<std::size_t>(std::distance(PolicyType::queue_.begin(), itr))});
@@ -75,8 +70,7 @@ void AnyAtOrBefore<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStam
     const ExtractionRange& extraction_range,
     const CaptureRange<stamp_type>& range)
 {
-  output = PolicyType::queue_.move(output, extraction_range);
-  PolicyType::queue_.remove_first_n(extraction_range.last);
+  output = PolicyType::queue_.extract_first_n(output, extraction_range.last);
 }
 
 template <
@@ -48,14 +48,9 @@ AnyBefore<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, Acces
   // The boundary before which messages are valid and after which they are not. Non-inclusive.
   const stamp_type boundary = range.upper_stamp - delay_;
 
-  auto itr = PolicyType::queue_.begin();
-
   // Collect all the messages that are earlier than the first driving message's
   // timestamp minus the delay
-  while (itr != PolicyType::queue_.end() and AccessStampT::get(*itr) < boundary)
-  {
-    ++itr;
-  }
+  const auto itr = PolicyType::queue_.lower_bound(cursor_, boundary);
 
   return std::make_tuple(
     State::PRIMED, ExtractionRange{0, static_cast<std::size_t>(std::distance(PolicyType::queue_.begin(), itr))});
@@ -74,8 +69,7 @@ void AnyBefore<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT,
   const ExtractionRange& extraction_range,
   const CaptureRange<stamp_type>& range)
 {
-  output = PolicyType::queue_.move(output, extraction_range);
-  PolicyType::queue_.remove_first_n(extraction_range.last);
+  output = PolicyType::queue_.extract_first_n(output, extraction_range.last);
 }
 
 template <
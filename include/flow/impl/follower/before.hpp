@@ -60,14 +60,9 @@ Before<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, AccessVa
     return std::make_tuple(State::RETRY, ExtractionRange{});
   }
 
-  auto itr = PolicyType::queue_.begin();
-
   // Collect all the messages that are earlier than the first driving message's
   // timestamp minus the delay
-  while (itr != PolicyType::queue_.end() and AccessStampT::get(*itr) < boundary)
-  {
-    ++itr;
-  }
+  const auto itr = PolicyType::queue_.lower_bound(cursor_, boundary);
 
   return std::make_tuple(
     State::PRIMED, ExtractionRange{0, static_cast<std::size_t>(std::distance(PolicyType::queue_.begin(), itr))});
@@ -87,8 +82,7 @@ void Before<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, Acc
   const ExtractionRange& extraction_range,
   const CaptureRange<stamp_type>& range)
 {
-  output = PolicyType::queue_.move(output, extraction_range);
-  PolicyType::queue_.remove_first_n(extraction_range.last);
+  output = PolicyType::queue_.extract_first_n(output, extraction_range.last);
 }
 
 
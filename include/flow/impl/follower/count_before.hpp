@@ -60,14 +60,9 @@ CountBefore<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, Acc
   // The boundary before which messages are valid and after which they are not. Non-inclusive.
   const stamp_type boundary = range.upper_stamp - delay_;
 
-  // Scroll to element boundary
-  size_type before_boundary_count = 0;
-  auto itr = PolicyType::queue_.begin();
-  while (itr != PolicyType::queue_.end() and boundary > AccessStampT::get(*itr))
-  {
-    ++before_boundary_count;
-    ++itr;
-  }
+  // Find element boundary
+  const auto itr = PolicyType::queue_.lower_bound(cursor_, boundary);
+  const auto before_boundary_count = static_cast<size_type>(std::distance(PolicyType::queue_.begin(), itr));
 
   // Count elements after boundary
   const bool at_or_after_boundary_count = itr != PolicyType::queue_.end();
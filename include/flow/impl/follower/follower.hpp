@@ -62,6 +62,21 @@ template <typename PolicyT> void Follower<PolicyT>::abort_policy_impl(const stam
 
 template <typename PolicyT> void Follower<PolicyT>::reset_policy_impl() { derived()->reset_follower_impl(); }
 
+
+template <typename PolicyT>
+WakeThreshold<typename Follower<PolicyT>::stamp_type>
+Follower<PolicyT>::wake_threshold_policy_impl(const CaptureRange<stamp_type>& range) const
+{
+  return derived()->wake_threshold_follower_impl(range);
+}
+
+
+template <typename PolicyT>
+std::size_t Follower<PolicyT>::extract_size_policy_impl(const ExtractionRange& extraction_range) const
+{
+  return derived()->extract_size_follower_impl(extraction_range);
+}
+
 }  // namespace flow
 
 #endif  // FLOW_IMPL_FOLLOWER_FOLLOWER_HPP
@@ -74,13 +74,9 @@ Latched<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, AccessV
     }
   }
 
-  // Find data closest to boundary, starting from oldest
-  // curr_qitr will never start at queue_.end() due to previous empty check
-  auto curr_qitr = PolicyType::queue_.begin();
-  while (curr_qitr != PolicyType::queue_.end() and AccessStampT::get(*curr_qitr) <= boundary)
-  {
-    ++curr_qitr;
-  }
+  // Find data closest to boundary
+  // curr_qitr will never be queue_.begin() due to previous oldest stamp check
+  const auto curr_qitr = PolicyType::queue_.upper_bound(cursor_, boundary);
   return std::make_tuple(
     State::PRIMED, ExtractionRange{0, static_cast<std::size_t>(std::distance(PolicyType::queue_.begin(), curr_qitr))});
 }
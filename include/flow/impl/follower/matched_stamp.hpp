@@ -49,26 +49,13 @@ MatchedStamp<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, Ac
     return std::make_tuple(State::ABORT, ExtractionRange{});
   }
 
-  ExtractionRange extraction_range;
+  // Queue is ordered, so all matching elements are contiguous
+  const auto first_itr = PolicyType::queue_.lower_bound(cursor_, range.lower_stamp);
+  const auto last_itr = PolicyType::queue_.upper_bound(first_itr, range.upper_stamp);
 
-  std::size_t element_index = 0;
-  for (auto element_itr = PolicyType::queue_.begin(); element_itr != PolicyType::queue_.end();
-       ++element_itr, ++element_index)
-  {
-    if (AccessStampT::get(*element_itr) < range.lower_stamp or AccessStampT::get(*element_itr) > range.upper_stamp)
-    {
-      continue;
-    }
-    else if (!extraction_range)
-    {
-      extraction_range.first = element_index;
-      extraction_range.last = element_index + 1UL;  // one-past last (iterator-like)
-    }
-    else
-    {
-      ++extraction_range.last;
-    }
-  }
+  const ExtractionRange extraction_range{
+    static_cast<std::size_t>(std::distance(PolicyType::queue_.begin(), first_itr)),
+    static_cast<std::size_t>(std::distance(PolicyType::queue_.begin(), last_itr))};
 
   // Assign matching element
   return std::make_tuple(static_cast<bool>(extraction_range) ? State::PRIMED : State::RETRY, extraction_range);
@@ -108,12 +108,7 @@ template <
 auto Ranged<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, AccessValueT>::find_after_first(
   const CaptureRange<stamp_type>& range) const
 {
-  return std::find_if(
-    PolicyType::queue_.begin(),
-    PolicyType::queue_.end(),
-    [offset_lower_stamp = (range.lower_stamp - delay_)](const DispatchT& dispatch) {
-      return AccessStampT::get(dispatch) >= offset_lower_stamp;
-    });
+  return PolicyType::queue_.lower_bound(cursor_, range.lower_stamp - delay_);
 }
 
 
@@ -129,12 +124,7 @@ auto Ranged<DispatchT, LockPolicyT, ContainerT, QueueMonitorT, AccessStampT, Acc
   const CaptureRange<stamp_type>& range,
   const QueueIteratorT after_first) const
 {
-  return std::find_if_not(
-    after_first == PolicyType::queue_.end() ? PolicyType::queue_.begin() : after_first,
-    PolicyType::queue_.end(),
-    [offset_upper_stamp = (range.upper_stamp - delay_)](const DispatchT& dispatch) {
-      return AccessStampT::get(dispatch) <= offset_upper_stamp;
-    });
+  return PolicyType::queue_.upper_bound(after_first, range.upper_stamp - delay_);
 }
 
 template <
@@ -8,12 +8,18 @@
 #define FLOW_IMPL_SYNCHRONIZER_HPP
 
 // C++ Standard Library
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <mutex>
 #include <tuple>
 #include <type_traits>
 #include <utility>
 
 // Flow
 #include <flow/utility/apply.hpp>
+#include <flow/utility/integer_sequence.hpp>
 #include <flow/utility/static_assert.hpp>
 
 namespace std
@@ -214,6 +220,185 @@ private:
   ResultT* const result_;
 };
 
+/// captor::defer_lock call helper
+struct DeferLockHelper
+{
+  /// Nothing to lock
+  template <typename StampT> constexpr NullLock operator()(const CaptureRange<StampT>& range) const
+  {
+    return NullLock{};
+  }
+
+  template <typename CaptorT, typename LockPolicyT, typename QueueMonitorT>
+  inline auto operator()(Captor<CaptorT, LockPolicyT, QueueMonitorT>& c)
+  {
+    return c.defer_lock();
+  }
+};
+
+
+/// captor::locate_locked call helper
+template <typename ResultT, typename StampT> class LockedLocateHelper
+{
+public:
+  LockedLocateHelper(ResultT& result, const StampT lower_bound) :
+      result_{std::addressof(result)},
+      lower_bound_{lower_bound}
+  {}
+
+  inline void operator()(const CaptureRange<StampT>& range, ExtractionRange& NO_CAPTURE)
+  {
+    // Initialize capture range
+    result_->range = range;
+
+    // Set aborted state if driving sequence range violates monotonicity guard
+    result_->state = range.upper_stamp < lower_bound_ ? State::ABORT : State::PRIMED;
+    ready_count_ = (result_->state == State::PRIMED) ? 1UL : 0UL;
+  }
+
+  template <typename PolicyT> inline void operator()(Driver<PolicyT>& c, ExtractionRange& extraction_range)
+  {
+    // Get capture state
+    std::tie(result_->state, extraction_range) = c.locate_locked(result_->range);
+
+    // Set aborted state if driving sequence range violates monotonicity guard
+    if (result_->state == State::PRIMED and result_->range.upper_stamp < lower_bound_)
+    {
+      result_->state = State::ERROR_DRIVER_LOWER_BOUND_EXCEEDED;
+    }
+    ready_count_ = (result_->state == State::PRIMED) ? 1UL : 0UL;
+  }
+
+  template <typename PolicyT> inline void operator()(Follower<PolicyT>& c, ExtractionRange& extraction_range)
+  {
+    // Get capture state alias
+    if (result_->state == State::PRIMED)
+    {
+      std::tie(result_->state, extraction_range) = c.locate_locked(result_->range);
+      ready_count_ += (result_->state == State::PRIMED) ? 1UL : 0UL;
+    }
+  }
+
+  /// Returns number of leading captors which were ready, i.e. the index of the first captor which was not
+  inline std::size_t ready_count() const { return ready_count_; }
+
+private:
+  /// Capture result
+  ResultT* const result_;
+
+  /// Known latest sequence stamp
+  StampT lower_bound_;
+
+  /// Number of leading captors which were ready
+  std::size_t ready_count_ = 0UL;
+};
+
+
+/// captor::extract_locked call helper
+template <typename ResultT> class LockedExtractHelper
+{
+public:
+  LockedExtractHelper(ResultT& result) : result_{std::addressof(result)} {}
+
+  template <typename StampT>
+  constexpr NoCapture
+  operator()(const CaptureRange<StampT>& range, NoCapture __nc__, const ExtractionRange& extraction_range)
+  {
+    return NoCapture{};
+  }
+
+  template <typename CaptorT, typename LockPolicyT, typename QueueMonitorT, typename OutputIteratorT>
+  inline OutputIteratorT operator()(
+    Captor<CaptorT, LockPolicyT, QueueMonitorT>& c,
+    OutputIteratorT output,
+    const ExtractionRange& extraction_range)
+  {
+    return c.extract_locked(output, extraction_range, result_->range, result_->state);
+  }
+
+private:
+  /// Capture result
+  ResultT* const result_;
+};
+
+
+/// captor::generation_locked call helper
+struct GenerationHelper
+{
+  /// Nothing queued
+  template <typename StampT>
+  inline void operator()(const CaptureRange<StampT>& range, std::uint64_t& generation) const
+  {
+    generation = 0UL;
+  }
+
+  template <typename CaptorT, typename LockPolicyT, typename QueueMonitorT>
+  inline void operator()(const Captor<CaptorT, LockPolicyT, QueueMonitorT>& c, std::uint64_t& generation) const
+  {
+    generation = c.generation_locked();
+  }
+};
+
+
+/// captor::extract_size_locked call helper
+struct ExtractSizeHelper
+{
+  /// Nothing to extract
+  template <typename StampT>
+  inline void
+  operator()(const CaptureRange<StampT>& range, const ExtractionRange& extraction_range, std::size_t& size) const
+  {
+    size = 0UL;
+  }
+
+  template <typename CaptorT, typename LockPolicyT, typename QueueMonitorT>
+  inline void operator()(
+    const Captor<CaptorT, LockPolicyT, QueueMonitorT>& c,
+    const ExtractionRange& extraction_range,
+    std::size_t& size) const
+  {
+    size = c.extract_size_locked(extraction_range);
+  }
+};
+
+
+/// Checks if a driving capture range is the one which a located result was found with
+template <typename StampT, typename ResultT>
+inline bool driver_unchanged(const CaptureRange<StampT>& range, const ResultT& located_result)
+{
+  return range.lower_stamp == located_result.range.lower_stamp and
+    range.upper_stamp == located_result.range.upper_stamp;
+}
+
+/// Overload for driver captors, whose changes are tracked by queue generation
+template <typename DriverT, typename ResultT> inline bool driver_unchanged(const DriverT& driver, const ResultT&)
+{
+  return true;
+}
+
+
+/// Acquires all \p locks together, using a deadlock avoidance algorithm
+template <typename LockTupleT, std::size_t... LockIndices>
+inline void lock_all(LockTupleT& locks, index_sequence<LockIndices...>)
+{
+  std::lock(std::get<LockIndices>(locks)...);
+}
+
+/// Overload for single lock case, which <code>std::lock</code> does not accept
+template <typename LockTupleT> inline void lock_all(LockTupleT& locks, index_sequence<0UL>)
+{
+  std::get<0UL>(locks).lock();
+}
+
+/// Releases all \p locks, in reverse order
+template <typename LockTupleT, std::size_t... LockIndices>
+inline void unlock_all_reversed(LockTupleT& locks, index_sequence<LockIndices...>)
+{
+  constexpr std::size_t N = sizeof...(LockIndices);
+  const int unlocked[] = {(std::get<N - 1UL - LockIndices>(locks).unlock(), 0)...};
+  (void)unlocked;
+}
+
 /// Checks that captor stamp types are consistent
 template <typename... CaptorTs> struct captor_stamp_types_consistent;
 
@@ -345,6 +530,258 @@ typename std::tuple<Synchronizer::result_t<CaptorTupleT>, OutputIteratorTupleT>
     std::chrono::steady_clock::time_point::max());
 }
 
+template <typename CaptorTupleT, typename OutputIteratorTupleT>
+typename std::tuple<Synchronizer::result_t<CaptorTupleT>, OutputIteratorTupleT> Synchronizer::capture_locked(
+  CaptorTupleT&& captors,
+  OutputIteratorTupleT&& outputs,
+  const stamp_arg_t<CaptorTupleT> lower_bound)
+{
+  // Sanity check captors and outputs
+  constexpr auto N_CAPTORS = std::tuple_size<std::remove_reference_t<CaptorTupleT>>();
+  constexpr auto N_OUTPUTS = std::tuple_size<std::remove_reference_t<OutputIteratorTupleT>>();
+  FLOW_STATIC_ASSERT(N_OUTPUTS == N_CAPTORS, "[Synchronizer] Number of outputs must match number of captors.");
+
+  // Sanity check captor sequence
+  FLOW_STATIC_ASSERT(
+    detail::captor_sequence_valid<CaptorTupleT>(),
+    "[Synchronizer::capture_locked] Captor sequence is invalid. Must have (DriverType, FollowerTypes...) with "
+    "0 or more FollowerTypes allowed, or (CaptureRange<StampT>, FollowerTypes...) with at least 1 FollowerTypes.");
+
+  // Sanity check captor stamp types
+  FLOW_STATIC_ASSERT(
+    detail::captor_stamp_types_consistent<CaptorTupleT>(),
+    "[Synchronizer::capture_locked] Associated captor stamp types do not match between all captors");
+
+  using ResultType = result_t<CaptorTupleT>;
+  using StampType = stamp_t<CaptorTupleT>;
+
+  auto elements = detail::exchange_type_with<ExtractionRange>(captors);
+
+  // Lock all captors together; locks are released on scope exit if extraction throws
+  auto locks = apply_every_r(detail::DeferLockHelper{}, std::forward<CaptorTupleT>(captors));
+  detail::lock_all(locks, make_index_sequence<N_CAPTORS>{});
+
+  ResultType result;
+
+  // Attempt to locate elements that we will capture
+  apply_every(
+    detail::LockedLocateHelper<ResultType, StampType>{result, lower_bound},
+    std::forward<CaptorTupleT>(captors),
+    elements);
+
+  // If a RETRY state occurs, don't try to capture elements
+  if (result.state == State::RETRY)
+  {
+    detail::unlock_all_reversed(locks, make_index_sequence<N_CAPTORS>{});
+    return std::make_tuple(result, std::forward<OutputIteratorTupleT>(outputs));
+  }
+
+  // Otherwise, capture elements and possibly remove elements from queues
+  const auto outputs_advanced = apply_every_r(
+    detail::LockedExtractHelper<ResultType>{result},
+    std::forward<CaptorTupleT>(captors),
+    std::forward<OutputIteratorTupleT>(outputs),
+    elements);
+
+  detail::unlock_all_reversed(locks, make_index_sequence<N_CAPTORS>{});
+  return std::make_tuple(result, outputs_advanced);
+}
+
+
+template <typename CaptorTupleT>
+Synchronizer::locate_result_t<CaptorTupleT>
+Synchronizer::locate(CaptorTupleT&& captors, const stamp_arg_t<CaptorTupleT> lower_bound)
+{
+  // Sanity check captor sequence
+  FLOW_STATIC_ASSERT(
+    detail::captor_sequence_valid<CaptorTupleT>(),
+    "[Synchronizer::locate] Captor sequence is invalid. Must have (DriverType, FollowerTypes...) with "
+    "0 or more FollowerTypes allowed, or (CaptureRange<StampT>, FollowerTypes...) with at least 1 FollowerTypes.");
+
+  // Sanity check captor stamp types
+  FLOW_STATIC_ASSERT(
+    detail::captor_stamp_types_consistent<CaptorTupleT>(),
+    "[Synchronizer::locate] Associated captor stamp types do not match between all captors");
+
+  constexpr auto N_CAPTORS = std::tuple_size<std::remove_reference_t<CaptorTupleT>>();
+
+  using ResultType = result_t<CaptorTupleT>;
+  using StampType = stamp_t<CaptorTupleT>;
+
+  locate_result_t<CaptorTupleT> located{};
+  located.lower_bound = lower_bound;
+
+  auto locks = apply_every_r(detail::DeferLockHelper{}, captors);
+  detail::lock_all(locks, make_index_sequence<N_CAPTORS>{});
+
+  // Generations are read after locating, which may itself bring pending data into a captor queue
+  apply_every(detail::LockedLocateHelper<ResultType, StampType>{located.result, lower_bound}, captors, located.ranges);
+  apply_every(detail::GenerationHelper{}, captors, located.generations);
+  if (located.result.state == State::PRIMED)
+  {
+    apply_every(detail::ExtractSizeHelper{}, captors, located.ranges, located.sizes);
+  }
+
+  detail::unlock_all_reversed(locks, make_index_sequence<N_CAPTORS>{});
+  return located;
+}
+
+
+template <typename CaptorTupleT, typename OutputIteratorTupleT>
+typename std::tuple<Synchronizer::result_t<CaptorTupleT>, OutputIteratorTupleT> Synchronizer::capture_locked(
+  CaptorTupleT&& captors,
+  OutputIteratorTupleT&& outputs,
+  const locate_result_t<CaptorTupleT>& located)
+{
+  // Sanity check captors and outputs
+  constexpr auto N_CAPTORS = std::tuple_size<std::remove_reference_t<CaptorTupleT>>();
+  constexpr auto N_OUTPUTS = std::tuple_size<std::remove_reference_t<OutputIteratorTupleT>>();
+  FLOW_STATIC_ASSERT(N_OUTPUTS == N_CAPTORS, "[Synchronizer] Number of outputs must match number of captors.");
+
+  // Sanity check captor sequence
+  FLOW_STATIC_ASSERT(
+    detail::captor_sequence_valid<CaptorTupleT>(),
+    "[Synchronizer::capture_locked] Captor sequence is invalid. Must have (DriverType, FollowerTypes...) with "
+    "0 or more FollowerTypes allowed, or (CaptureRange<StampT>, FollowerTypes...) with at least 1 FollowerTypes.");
+
+  // Sanity check captor stamp types
+  FLOW_STATIC_ASSERT(
+    detail::captor_stamp_types_consistent<CaptorTupleT>(),
+    "[Synchronizer::capture_locked] Associated captor stamp types do not match between all captors");
+
+  using ResultType = result_t<CaptorTupleT>;
+  using StampType = stamp_t<CaptorTupleT>;
+
+  // Lock all captors together; locks are released on scope exit if extraction throws
+  auto locks = apply_every_r(detail::DeferLockHelper{}, captors);
+  detail::lock_all(locks, make_index_sequence<N_CAPTORS>{});
+
+  ResultType result = located.result;
+  auto elements = located.ranges;
+
+  // Locate again only if any captor has changed since located
+  std::array<std::uint64_t, N_CAPTORS> generations;
+  apply_every(detail::GenerationHelper{}, captors, generations);
+  if (generations != located.generations or !detail::driver_unchanged(std::get<0>(captors), located.result))
+  {
+    result = ResultType{};
+    apply_every(detail::LockedLocateHelper<ResultType, StampType>{result, located.lower_bound}, captors, elements);
+  }
+
+  // If a RETRY state occurs, don't try to capture elements
+  if (result.state == State::RETRY)
+  {
+    detail::unlock_all_reversed(locks, make_index_sequence<N_CAPTORS>{});
+    return std::make_tuple(result, std::forward<OutputIteratorTupleT>(outputs));
+  }
+
+  // Otherwise, capture elements and possibly remove elements from queues
+  const auto outputs_advanced = apply_every_r(
+    detail::LockedExtractHelper<ResultType>{result}, captors, std::forward<OutputIteratorTupleT>(outputs), elements);
+
+  detail::unlock_all_reversed(locks, make_index_sequence<N_CAPTORS>{});
+  return std::make_tuple(result, outputs_advanced);
+}
+
+
+template <typename CaptorTupleT, typename OutputIteratorTupleT, typename FrameCallbackT>
+typename std::tuple<Synchronizer::result_t<CaptorTupleT>, Synchronizer::outputs_t<OutputIteratorTupleT>>
+Synchronizer::capture_n(
+  CaptorTupleT&& captors,
+  OutputIteratorTupleT&& outputs,
+  FrameCallbackT&& frame_callback,
+  const std::size_t max_frames,
+  const stamp_arg_t<CaptorTupleT> lower_bound)
+{
+  // Sanity check captors and outputs
+  constexpr auto N_CAPTORS = std::tuple_size<std::remove_reference_t<CaptorTupleT>>();
+  constexpr auto N_OUTPUTS = std::tuple_size<std::remove_reference_t<OutputIteratorTupleT>>();
+  FLOW_STATIC_ASSERT(N_OUTPUTS == N_CAPTORS, "[Synchronizer] Number of outputs must match number of captors.");
+
+  // Sanity check captor sequence
+  FLOW_STATIC_ASSERT(
+    detail::captor_sequence_valid<CaptorTupleT>(),
+    "[Synchronizer::capture_n] Captor sequence is invalid. Must have (DriverType, FollowerTypes...) with "
+    "0 or more FollowerTypes allowed, or (CaptureRange<StampT>, FollowerTypes...) with at least 1 FollowerTypes.");
+
+  // Sanity check captor stamp types
+  FLOW_STATIC_ASSERT(
+    detail::captor_stamp_types_consistent<CaptorTupleT>(),
+    "[Synchronizer::capture_n] Associated captor stamp types do not match between all captors");
+
+  using ResultType = result_t<CaptorTupleT>;
+  using StampType = stamp_t<CaptorTupleT>;
+
+  // A capture range only describes a single frame
+  using DriverType = std::remove_reference_t<std::tuple_element_t<0UL, std::remove_reference_t<CaptorTupleT>>>;
+  constexpr bool DRIVEN_BY_RANGE = is_capture_range<std::remove_cv_t<DriverType>>::value;
+
+  auto elements = detail::exchange_type_with<ExtractionRange>(captors);
+  outputs_t<OutputIteratorTupleT> outputs_advanced{std::forward<OutputIteratorTupleT>(outputs)};
+
+  // Lock all captors together, once for all frames; locks are released on scope exit if extraction throws
+  auto locks = apply_every_r(detail::DeferLockHelper{}, captors);
+  detail::lock_all(locks, make_index_sequence<N_CAPTORS>{});
+
+  ResultType result;
+  for (std::size_t n_frames = 0UL; n_frames < max_frames; ++n_frames)
+  {
+    ResultType attempt;
+
+    // Attempt to locate elements of the next frame
+    apply_every(detail::LockedLocateHelper<ResultType, StampType>{attempt, lower_bound}, captors, elements);
+
+    // If a RETRY state occurs, no more frames are ready; once frames have been captured, any other frame which would
+    // not be captured is left in place for the next call, so that the returned result is that of the last frame
+    if (attempt.state == State::RETRY or (n_frames > 0UL and attempt.state != State::PRIMED))
+    {
+      if (n_frames == 0UL)
+      {
+        result = attempt;
+      }
+      break;
+    }
+
+    // Otherwise, capture elements and possibly remove elements from queues
+    result = attempt;
+    outputs_advanced =
+      apply_every_r(detail::LockedExtractHelper<ResultType>{result}, captors, outputs_advanced, elements);
+
+    if (result.state != State::PRIMED)
+    {
+      break;
+    }
+
+    frame_callback(static_cast<const ResultType&>(result));
+
+    if (DRIVEN_BY_RANGE)
+    {
+      break;
+    }
+  }
+
+  detail::unlock_all_reversed(locks, make_index_sequence<N_CAPTORS>{});
+  return std::make_tuple(result, outputs_advanced);
+}
+
+
+template <typename CaptorTupleT, typename OutputIteratorTupleT, typename FrameCallbackT>
+typename std::tuple<Synchronizer::result_t<CaptorTupleT>, Synchronizer::outputs_t<OutputIteratorTupleT>>
+Synchronizer::capture_all(
+  CaptorTupleT&& captors,
+  OutputIteratorTupleT&& outputs,
+  FrameCallbackT&& frame_callback,
+  const stamp_arg_t<CaptorTupleT> lower_bound)
+{
+  return capture_n(
+    std::forward<CaptorTupleT>(captors),
+    std::forward<OutputIteratorTupleT>(outputs),
+    std::forward<FrameCallbackT>(frame_callback),
+    std::numeric_limits<std::size_t>::max(),
+    lower_bound);
+}
+
+
 template <typename CaptorTupleT>
 void Synchronizer::remove(CaptorTupleT&& captors, const stamp_arg_t<CaptorTupleT> t_remove)
 {
@@ -0,0 +1,116 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ *
+ * @warning IMPLEMENTATION ONLY: THIS FILE SHOULD NEVER BE INCLUDED DIRECTLY!
+ */
+#ifndef FLOW_IMPL_SYNCHRONIZER_GROUP_HPP
+#define FLOW_IMPL_SYNCHRONIZER_GROUP_HPP
+
+// C++ Standard Library
+#include <tuple>
+#include <utility>
+
+// Flow
+#include <flow/utility/apply.hpp>
+#include <flow/utility/static_assert.hpp>
+
+namespace flow
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/// captor::set_group_notifier call helper
+class AttachHelper
+{
+public:
+  explicit AttachHelper(GroupNotifier* const group_notifier) : group_notifier_{group_notifier} {}
+
+  template <typename CaptorT, typename LockPolicyT, typename QueueMonitorT>
+  inline void operator()(Captor<CaptorT, LockPolicyT, QueueMonitorT>& c)
+  {
+    c.set_group_notifier(group_notifier_);
+  }
+
+private:
+  /// Notifier to attach, or nullptr to detach
+  GroupNotifier* group_notifier_;
+};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+
+template <typename... CaptorTs>
+SynchronizerGroup<CaptorTs...>::SynchronizerGroup(CaptorTs&... captors) : captors_{captors...}
+{
+  // Sanity check captor sequence
+  FLOW_STATIC_ASSERT(
+    detail::captor_sequence_valid<CaptorTupleType>(),
+    "[SynchronizerGroup] Captor sequence is invalid. Must have (DriverType, FollowerTypes...) with "
+    "0 or more FollowerTypes allowed.");
+
+  // Sanity check captor stamp types
+  FLOW_STATIC_ASSERT(
+    detail::captor_stamp_types_consistent<CaptorTupleType>(),
+    "[SynchronizerGroup] Associated captor stamp types do not match between all captors");
+
+  apply_every(detail::AttachHelper{&notifier_}, captors_);
+}
+
+
+template <typename... CaptorTs> SynchronizerGroup<CaptorTs...>::~SynchronizerGroup()
+{
+  apply_every(detail::AttachHelper{nullptr}, captors_);
+}
+
+
+template <typename... CaptorTs>
+template <typename OutputIteratorTupleT, typename ClockT, typename DurationT>
+std::tuple<typename SynchronizerGroup<CaptorTs...>::result_type, OutputIteratorTupleT>
+SynchronizerGroup<CaptorTs...>::capture(
+  OutputIteratorTupleT&& outputs,
+  const stamp_type lower_bound,
+  const std::chrono::time_point<ClockT, DurationT>& timeout)
+{
+  // Sanity check captors and outputs
+  FLOW_STATIC_ASSERT(
+    std::tuple_size<std::remove_reference_t<OutputIteratorTupleT>>() == sizeof...(CaptorTs),
+    "[SynchronizerGroup] Number of outputs must match number of captors.");
+
+  while (true)
+  {
+    // Changes signaled after this point will end the next wait
+    const auto observed_version = notifier_.version();
+
+    // Attempt capture under all captor locks, without waiting on any single captor; outputs are left untouched when
+    // synchronization is not yet possible
+    auto result_and_outputs = Synchronizer::capture_locked(
+      CaptorTupleType{captors_}, std::forward<OutputIteratorTupleT>(outputs), lower_bound);
+
+    if (std::get<0>(result_and_outputs).state != State::RETRY)
+    {
+      return result_and_outputs;
+    }
+    else if (!notifier_.wait(observed_version, timeout))
+    {
+      std::get<0>(result_and_outputs).state = State::TIMEOUT;
+      return result_and_outputs;
+    }
+  }
+}
+
+
+template <typename... CaptorTs>
+template <typename OutputIteratorTupleT>
+std::tuple<typename SynchronizerGroup<CaptorTs...>::result_type, OutputIteratorTupleT>
+SynchronizerGroup<CaptorTs...>::capture(OutputIteratorTupleT&& outputs, const stamp_type lower_bound)
+{
+  return capture(
+    std::forward<OutputIteratorTupleT>(outputs), lower_bound, std::chrono::steady_clock::time_point::max());
+}
+
+}  // namespace flow
+
+#endif  // FLOW_IMPL_SYNCHRONIZER_GROUP_HPP
@@ -6,8 +6,12 @@
 #define FLOW_SYNCHRONIZER_HPP
 
 // C++ Standard Library
+#include <array>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <tuple>
+#include <type_traits>
 
 // Flow
 #include <flow/captor.hpp>
@@ -40,6 +44,40 @@ template <typename StampT> struct Result
 };
 
 
+/**
+ * @brief Non-destructive synchronization result, with everything needed to capture the located frame later
+ *
+ * Returned by <code>Synchronizer::locate</code>. Extraction ranges are tagged with the generation of each captor
+ * queue at the time they were found, so that <code>Synchronizer::capture_locked</code> can reuse them, rather than
+ * locating again, when no captor has changed since.
+ *
+ * @tparam StampT  capture sequencing stamp type
+ * @tparam N  number of captors
+ */
+template <typename StampT, std::size_t N> struct LocateResult
+{
+  /// Synchronization state and driving sequencing stamp range
+  Result<StampT> result;
+
+  /// Range of elements to extract from each captor
+  std::array<ExtractionRange, N> ranges;
+
+  /// Number of elements which each captor will output on capture; all zero unless synchronization succeeded
+  std::array<std::size_t, N> sizes;
+
+  /// Generation of each captor queue (see <code>CaptorInterface::generation_locked</code>) when located
+  std::array<std::uint64_t, N> generations;
+
+  /// Synchronization stamp lower bound used to locate
+  StampT lower_bound;
+
+  /**
+   * @brief Checks if synchronization is possible
+   */
+  inline explicit operator bool() const { return static_cast<bool>(result); }
+};
+
+
 /**
  * @brief Object used in place of output iterator as a placeholder with no data capture effects
  */
@@ -81,6 +119,25 @@ template <typename StampT> struct SequenceStampType<CaptureRange<StampT>>
 };
 
 
+/**
+ * @brief Resolves tuple type which holds each output iterator of an output iterator tuple by value
+ *
+ * @tparam OutputIteratorTupleT  tuple of output iterators, or references to output iterators
+ */
+template <typename OutputIteratorTupleT> struct OutputIteratorValuesType;
+
+
+/**
+ * @copydoc OutputIteratorValuesType
+ *
+ * @note partial specialization for <code>std::tuple</code>
+ */
+template <typename... OutputIteratorTs> struct OutputIteratorValuesType<std::tuple<OutputIteratorTs...>>
+{
+  using type = std::tuple<std::decay_t<OutputIteratorTs>...>;
+};
+
+
 /**
  * @brief Provides facilities to synchronize data across several Captors
  */
@@ -112,6 +169,24 @@ public:
    */
   template <typename CaptorTupleT> using result_t = Result<stamp_t<CaptorTupleT>>;
 
+  /**
+   * @brief Locate result type from captor sequence alias
+   *
+   * @tparam CaptorTupleT  tuple-like type of captors which supports access with <code>std::get</code>
+   */
+  template <typename CaptorTupleT>
+  using locate_result_t =
+    LocateResult<stamp_t<CaptorTupleT>, std::tuple_size<std::remove_reference_t<CaptorTupleT>>::value>;
+
+  /**
+   * @brief Output iterator tuple type, with each output iterator held by value, alias
+   *
+   * @tparam OutputIteratorTupleT  tuple-like type of iterators which supports access with <code>std::get</code>
+   */
+  template <typename OutputIteratorTupleT>
+  using outputs_t =
+    typename OutputIteratorValuesType<std::remove_cv_t<std::remove_reference_t<OutputIteratorTupleT>>>::type;
+
   /**
    * @brief Removes all possible synchronization frames at and before \p t_remove
    *
@@ -189,6 +264,142 @@ public:
     CaptorTupleT&& captors,
     OutputIteratorTupleT&& outputs,
     const stamp_arg_t<CaptorTupleT> lower_bound = StampTraits<stamp_t<CaptorTupleT>>::min());
+
+  /**
+   * @brief Runs synchronization and data capture across all captors, holding every captor lock for the whole capture
+   *
+   * Each captor is locked once, rather than separately for locate, extract and queue monitor update, and no captor
+   * can receive new data between locate and extract. Locks are acquired together with <code>std::lock</code>, which
+   * avoids deadlock regardless of the order in which other callers lock the same captors, and are released in the
+   * reverse order of \p captors.
+   * \n
+   * Never waits for data. When synchronization is not yet possible, returns with State::RETRY and leaves all captor
+   * queues unchanged.
+   *
+   * @tparam CaptorTupleT  tuple-like type of captors which supports access with <code>std::get</code>
+   * @tparam OutputIteratorTupleT  tuple-like type of iterators which supports access with <code>std::get</code>
+   *
+   * @param captors  tuple of captors used to perform synchronization
+   * @param outputs  tuple of dispatch output iterators, or NoCapture, ordered w.r.t associated Captor
+   * @param lower_bound  synchronization stamp lower bound, forces all captured data to have associated
+   *              stamps which are greater than <code>lower_bound</code>
+   *
+   * @return <code>{synchronization state, output iterators}</code>
+   */
+  template <typename CaptorTupleT, typename OutputIteratorTupleT>
+  static std::tuple<result_t<CaptorTupleT>, OutputIteratorTupleT> capture_locked(
+    CaptorTupleT&& captors,
+    OutputIteratorTupleT&& outputs,
+    const stamp_arg_t<CaptorTupleT> lower_bound = StampTraits<stamp_t<CaptorTupleT>>::min());
+
+  /**
+   * @brief Runs synchronization across all captors without capturing data
+   *
+   * Finds the next frame as <code>capture_locked</code> would, holding every captor lock while doing so, but leaves
+   * all captor queues and states unchanged. Never waits for data.
+   * \n
+   * The returned extraction ranges may be passed back to <code>capture_locked</code>, which then skips locating
+   * again if no captor has changed in the meantime; e.g. when readiness is polled before capturing. The number of
+   * elements each captor will output is also returned, so that output buffers can be sized before capture; these
+   * sizes hold for as long as the located frame is captured without locating again.
+   *
+   * @tparam CaptorTupleT  tuple-like type of captors which supports access with <code>std::get</code>
+   *
+   * @param captors  tuple of captors used to perform synchronization
+   * @param lower_bound  synchronization stamp lower bound, forces all captured data to have associated
+   *              stamps which are greater than <code>lower_bound</code>
+   *
+   * @return synchronization state, with per-captor extraction ranges and queue generations
+   */
+  template <typename CaptorTupleT>
+  static locate_result_t<CaptorTupleT> locate(
+    CaptorTupleT&& captors,
+    const stamp_arg_t<CaptorTupleT> lower_bound = StampTraits<stamp_t<CaptorTupleT>>::min());
+
+  /**
+   * @brief Captures a frame found by <code>locate</code>, holding every captor lock for the whole capture
+   *
+   * Behaves as <code>capture_locked</code> with <code>located.lower_bound</code>. When the queue generation of every
+   * captor (and the range, when driven by a CaptureRange) is unchanged since \p located was found, its extraction
+   * ranges are used as-is and the locate pass is skipped; otherwise, synchronization is run again.
+   *
+   * @tparam CaptorTupleT  tuple-like type of captors which supports access with <code>std::get</code>
+   * @tparam OutputIteratorTupleT  tuple-like type of iterators which supports access with <code>std::get</code>
+   *
+   * @param captors  tuple of captors used to perform synchronization; same as those passed to <code>locate</code>
+   * @param outputs  tuple of dispatch output iterators, or NoCapture, ordered w.r.t associated Captor
+   * @param located  result of a previous call to <code>locate</code> with \p captors
+   *
+   * @return <code>{synchronization state, output iterators}</code>
+   */
+  template <typename CaptorTupleT, typename OutputIteratorTupleT>
+  static std::tuple<result_t<CaptorTupleT>, OutputIteratorTupleT> capture_locked(
+    CaptorTupleT&& captors,
+    OutputIteratorTupleT&& outputs,
+    const locate_result_t<CaptorTupleT>& located);
+
+  /**
+   * @brief Captures up to \p max_frames ready synchronization frames, holding every captor lock for the whole batch
+   *
+   * Repeats the locate and extract steps of <code>capture_locked</code> while synchronization succeeds, locking each
+   * captor once for all frames. Data from every frame is written to \p outputs, and \p frame_callback is called with
+   * the result of each successful frame right after its data is written, so it may move that frame's data out of
+   * the output containers. Stops after the first frame which is not State::PRIMED, once \p max_frames frames have
+   * been captured, or after one frame when driven by a CaptureRange.
+   * \n
+   * Never waits for data. When at least one frame is captured, returns the result of the last captured frame; a
+   * following frame which would not be captured (e.g. one which would be aborted) is left in place, and is reported
+   * by the next call. When no frame is captured, returns the result of the failed attempt, as
+   * <code>capture_locked</code> would; in particular, when no frame is ready, returns with State::RETRY and leaves
+   * all captor queues unchanged.
+   *
+   * @warning \p frame_callback is called while all captors are locked; it must not call into the same captors, and
+   *          should be kept short, since producers cannot inject data until the batch is done
+   *
+   * @tparam CaptorTupleT  tuple-like type of captors which supports access with <code>std::get</code>
+   * @tparam OutputIteratorTupleT  tuple-like type of iterators which supports access with <code>std::get</code>
+   * @tparam FrameCallbackT  callable with signature <code>void(const result_t<CaptorTupleT>&)</code>
+   *
+   * @param captors  tuple of captors used to perform synchronization
+   * @param outputs  tuple of dispatch output iterators, or NoCapture, ordered w.r.t associated Captor
+   * @param frame_callback  called once per successfully captured frame
+   * @param max_frames  maximum number of frames to capture
+   * @param lower_bound  synchronization stamp lower bound, forces all captured data to have associated
+   *              stamps which are greater than <code>lower_bound</code>
+   *
+   * @return <code>{result of last captured frame, or of the failed attempt if none were, output iterators}</code>
+   */
+  template <typename CaptorTupleT, typename OutputIteratorTupleT, typename FrameCallbackT>
+  static std::tuple<result_t<CaptorTupleT>, outputs_t<OutputIteratorTupleT>> capture_n(
+    CaptorTupleT&& captors,
+    OutputIteratorTupleT&& outputs,
+    FrameCallbackT&& frame_callback,
+    const std::size_t max_frames,
+    const stamp_arg_t<CaptorTupleT> lower_bound = StampTraits<stamp_t<CaptorTupleT>>::min());
+
+  /**
+   * @brief Captures every ready synchronization frame, holding every captor lock for the whole batch
+   *
+   * Same as <code>capture_n</code>, with no limit on the number of frames
+   *
+   * @tparam CaptorTupleT  tuple-like type of captors which supports access with <code>std::get</code>
+   * @tparam OutputIteratorTupleT  tuple-like type of iterators which supports access with <code>std::get</code>
+   * @tparam FrameCallbackT  callable with signature <code>void(const result_t<CaptorTupleT>&)</code>
+   *
+   * @param captors  tuple of captors used to perform synchronization
+   * @param outputs  tuple of dispatch output iterators, or NoCapture, ordered w.r.t associated Captor
+   * @param frame_callback  called once per successfully captured frame
+   * @param lower_bound  synchronization stamp lower bound, forces all captured data to have associated
+   *              stamps which are greater than <code>lower_bound</code>
+   *
+   * @return <code>{result of last captured frame, or of the failed attempt if none were, output iterators}</code>
+   */
+  template <typename CaptorTupleT, typename OutputIteratorTupleT, typename FrameCallbackT>
+  static std::tuple<result_t<CaptorTupleT>, outputs_t<OutputIteratorTupleT>> capture_all(
+    CaptorTupleT&& captors,
+    OutputIteratorTupleT&& outputs,
+    FrameCallbackT&& frame_callback,
+    const stamp_arg_t<CaptorTupleT> lower_bound = StampTraits<stamp_t<CaptorTupleT>>::min());
 };
 
 }  // namespace flow
@@ -0,0 +1,126 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_SYNCHRONIZER_GROUP_HPP
+#define FLOW_SYNCHRONIZER_GROUP_HPP
+
+// C++ Standard Library
+#include <chrono>
+#include <tuple>
+
+// Flow
+#include <flow/group_notifier.hpp>
+#include <flow/synchronizer.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Synchronizes a fixed set of captors, waiting on a single notifier shared by all of them
+ *
+ * On construction, all captors are attached to a GroupNotifier owned by the group, which they signal whenever their
+ * buffers change. <code>SynchronizerGroup::capture</code> then evaluates all captors with
+ * <code>Synchronizer::capture_locked</code>, without waiting on any one of them, and waits once on the shared notifier
+ * when synchronization is not yet possible. Compared to
+ * <code>Synchronizer::capture</code>, which waits on each blocking captor in turn, this replaces a chain of sleep/wake
+ * cycles on different mutexes with one wait per change to any captor.
+ * \n
+ * Works with any mix of lock policies; polling captors (e.g. <code>PollingLock</code>, <code>MPSCLane</code>) become
+ * blocking when used in a group.
+ *
+ * @tparam CaptorTs  captor types, as (DriverType, FollowerTypes...)
+ *
+ * @warning Captors must outlive the group, and must not be in more than one group at a time
+ */
+template <typename... CaptorTs> class SynchronizerGroup
+{
+public:
+  /// Tuple of captor references
+  using CaptorTupleType = std::tuple<CaptorTs&...>;
+
+  /// Synchronization result type
+  using result_type = Synchronizer::result_t<CaptorTupleType>;
+
+  /// Stamp type
+  using stamp_type = Synchronizer::stamp_t<CaptorTupleType>;
+
+  /**
+   * @brief Attaches \p captors to group notifier
+   *
+   * @param captors  captors used to perform synchronization, as (driver, followers...)
+   */
+  explicit SynchronizerGroup(CaptorTs&... captors);
+
+  SynchronizerGroup(const SynchronizerGroup&) = delete;
+
+  SynchronizerGroup& operator=(const SynchronizerGroup&) = delete;
+
+  /**
+   * @brief Detaches captors from group notifier
+   */
+  ~SynchronizerGroup();
+
+  /**
+   * @brief Runs synchronization and data capture across all captors
+   *
+   * @tparam OutputIteratorTupleT  tuple-like type of iterators which supports access with <code>std::get</code>
+   * @tparam ClockT  clock type associated with <code>time_point</code>
+   * @tparam DurationT  duration type associated with <code>time_point</code>
+   *
+   * @param outputs  tuple of dispatch output iterators, or NoCapture, ordered w.r.t associated Captor
+   * @param lower_bound  synchronization stamp lower bound, forces all captured data to have associated
+   *              stamps which are greater than <code>lower_bound</code>
+   * @param timeout  time at which to stop waiting for synchronization
+   *
+   * @return <code>{synchronization state, output iterators}</code>
+   */
+  template <typename OutputIteratorTupleT, typename ClockT, typename DurationT>
+  std::tuple<result_type, OutputIteratorTupleT> capture(
+    OutputIteratorTupleT&& outputs,
+    const stamp_type lower_bound,
+    const std::chrono::time_point<ClockT, DurationT>& timeout);
+
+  /**
+   * @copydoc capture
+   *
+   * @note Waits indefinitely
+   */
+  template <typename OutputIteratorTupleT>
+  std::tuple<result_type, OutputIteratorTupleT>
+  capture(OutputIteratorTupleT&& outputs, const stamp_type lower_bound = StampTraits<stamp_type>::min());
+
+  /**
+   * @copydoc Synchronizer::remove
+   */
+  inline void remove(const stamp_type t_remove) { Synchronizer::remove(CaptorTupleType{captors_}, t_remove); }
+
+  /**
+   * @copydoc Synchronizer::abort
+   */
+  inline void abort(const stamp_type t_abort) { Synchronizer::abort(CaptorTupleType{captors_}, t_abort); }
+
+  /**
+   * @copydoc Synchronizer::reset
+   */
+  inline void reset() { Synchronizer::reset(CaptorTupleType{captors_}); }
+
+  /**
+   * @brief Returns notifier shared by all captors in this group
+   */
+  inline GroupNotifier& get_notifier() { return notifier_; }
+
+private:
+  /// Captors used to perform synchronization
+  CaptorTupleType captors_;
+
+  /// Notifier signaled by all captors
+  GroupNotifier notifier_;
+};
+
+}  // namespace flow
+
+// Flow (implementation)
+#include <flow/impl/synchronizer_group.hpp>
+
+#endif  // FLOW_SYNCHRONIZER_GROUP_HPP
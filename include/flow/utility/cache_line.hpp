@@ -0,0 +1,21 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_UTILITY_CACHE_LINE_HPP
+#define FLOW_UTILITY_CACHE_LINE_HPP
+
+// C++ Standard Library
+#include <cstddef>
+
+namespace flow
+{
+
+/**
+ * @brief Assumed size of a cache line, used to keep state written by different threads apart
+ */
+static constexpr std::size_t CacheLineSize = 64UL;
+
+}  // namespace flow
+
+#endif  // FLOW_UTILITY_CACHE_LINE_HPP
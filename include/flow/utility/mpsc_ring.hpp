@@ -0,0 +1,189 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_UTILITY_MPSC_RING_HPP
+#define FLOW_UTILITY_MPSC_RING_HPP
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Flow
+#include <flow/utility/cache_line.hpp>
+#include <flow/utility/static_assert.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Bounded, lock-free, multi-producer/single-consumer ring
+ *
+ * Any number of threads may call <code>try_emplace</code> while one other thread calls <code>consume_all</code>.
+ * Producers claim slots with a compare-and-swap on a shared position, and publish each element with a per-slot
+ * sequence number, so that a producer never waits on the consumer, or on another producer which has stalled part way
+ * through publishing. Elements are held in storage allocated once, on construction.
+ *
+ * @tparam T  element type
+ * @tparam N  capacity; must be a power of two
+ */
+template <typename T, std::size_t N> class MPSCRing
+{
+  FLOW_STATIC_ASSERT(N > 0UL and (N & (N - 1UL)) == 0UL, "'N' must be a power of two");
+
+public:
+  MPSCRing() : cells_{new Cell[N]}
+  {
+    for (std::size_t pos = 0; pos < N; ++pos)
+    {
+      cells_[pos].sequence.store(pos, std::memory_order_relaxed);
+    }
+  }
+
+  MPSCRing(const MPSCRing&) = delete;
+
+  MPSCRing& operator=(const MPSCRing&) = delete;
+
+  ~MPSCRing()
+  {
+    consume_all([](T&&) {});
+  }
+
+  /**
+   * @brief Returns maximum number of elements
+   */
+  static constexpr std::size_t capacity() { return N; }
+
+  /**
+   * @brief Returns number of elements in ring, including elements which are still being published
+   *
+   * @note Only a snapshot when called while other threads are active
+   */
+  inline std::size_t size() const
+  {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Checks if ring has no elements
+   *
+   * @copydetails size
+   */
+  inline bool empty() const { return size() == 0UL; }
+
+  /**
+   * @brief Constructs a new element at the back of the ring (producer side)
+   *
+   * @param args  element constructor arguments
+   *
+   * @retval true  if element was added
+   * @retval false  if ring was full; no element is constructed
+   */
+  template <typename... ArgTs> inline bool try_emplace(ArgTs&&... args)
+  {
+    std::size_t tail = tail_.load(std::memory_order_relaxed);
+    Cell* cell;
+    while (true)
+    {
+      cell = &cells_[tail & (N - 1UL)];
+      const auto lag = static_cast<std::intptr_t>(cell->sequence.load(std::memory_order_acquire) - tail);
+      if (lag == 0)
+      {
+        // Slot is free; claim it
+        if (tail_.compare_exchange_weak(tail, tail + 1UL, std::memory_order_relaxed))
+        {
+          break;
+        }
+      }
+      else if (lag < 0)
+      {
+        // Slot still holds an element from the previous lap
+        return false;
+      }
+      else
+      {
+        // Slot was claimed by another producer
+        tail = tail_.load(std::memory_order_relaxed);
+      }
+    }
+
+    new (cell->element()) T{std::forward<ArgTs>(args)...};
+    cell->sequence.store(tail + 1UL, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Moves all published elements, from oldest to newest, into a callback (consumer side)
+   *
+   * Stops at the first element which has been claimed, but not yet published, by a producer
+   *
+   * @param consume  callback invoked as <code>consume(T&& element)</code>
+   *
+   * @return number of consumed elements
+   *
+   * @note If \p consume throws, the element passed to it is discarded, and all later elements remain in the ring
+   */
+  template <typename ConsumeT> inline std::size_t consume_all(ConsumeT&& consume)
+  {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    std::size_t pos = head;
+    for (Cell* cell = &cells_[pos & (N - 1UL)]; cell->sequence.load(std::memory_order_acquire) == pos + 1UL;
+         cell = &cells_[pos & (N - 1UL)])
+    {
+      // Releases slot, even if consume throws
+      const ConsumedCell consumed{cell, pos, head_};
+      consume(std::move(*cell->element()));
+      ++pos;
+    }
+    return pos - head;
+  }
+
+private:
+  /// Storage for a single element, and its publication state
+  struct Cell
+  {
+    /// Equal to position of slot when free, and position plus one when holding a published element
+    std::atomic<std::size_t> sequence;
+
+    /// Uninitialized element storage
+    std::aligned_storage_t<sizeof(T), alignof(T)> storage;
+
+    /// Returns pointer to element storage
+    inline T* element() { return reinterpret_cast<T*>(&storage); }
+  };
+
+  /// Destroys a consumed element, then hands its slot back to producers and advances head past it, on scope exit
+  struct ConsumedCell
+  {
+    Cell* const cell;
+    const std::size_t pos;
+    std::atomic<std::size_t>& head;
+
+    ~ConsumedCell()
+    {
+      cell->element()->~T();
+
+      // Slot is reused by producers on their next lap
+      cell->sequence.store(pos + N, std::memory_order_release);
+      head.store(pos + 1UL, std::memory_order_release);
+    }
+  };
+
+  /// Element storage
+  std::unique_ptr<Cell[]> cells_;
+
+  /// Position of next element to consume; written by consumer only
+  alignas(CacheLineSize) std::atomic<std::size_t> head_{0UL};
+
+  /// Position of next slot to claim; shared by all producers
+  alignas(CacheLineSize) std::atomic<std::size_t> tail_{0UL};
+};
+
+}  // namespace flow
+
+#endif  // FLOW_UTILITY_MPSC_RING_HPP
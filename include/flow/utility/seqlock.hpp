@@ -0,0 +1,111 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_UTILITY_SEQLOCK_HPP
+#define FLOW_UTILITY_SEQLOCK_HPP
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <type_traits>
+
+// Flow
+#include <flow/utility/static_assert.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Holds a small value written by one thread at a time and read, without locking, by any number of threads
+ *
+ * Writes bump a sequence counter before and after updating the value. Readers retry until they copy the value
+ * without a write overlapping, so readers never block writers, and a reader always sees a value which was stored
+ * as a whole. The value is held as words which are each accessed atomically, so there are no data races on it.
+ *
+ * @tparam T  value type; must be trivially copyable and default constructible
+ *
+ * @warning Calls to <code>store</code> must be serialized by the caller (e.g. made under an existing lock)
+ */
+template <typename T> class SeqLock
+{
+  FLOW_STATIC_ASSERT(std::is_trivially_copyable<T>(), "'T' must be trivially copyable");
+
+public:
+  SeqLock() : SeqLock{T{}} {}
+
+  explicit SeqLock(const T& value) { store(value); }
+
+  SeqLock(const SeqLock& other) : SeqLock{other.load()} {}
+
+  SeqLock& operator=(const SeqLock& other)
+  {
+    store(other.load());
+    return *this;
+  }
+
+  /**
+   * @brief Publishes a new value (writer side)
+   */
+  inline void store(const T& value)
+  {
+    WordType words[N_WORDS] = {};
+    std::memcpy(words, std::addressof(value), sizeof(T));
+
+    const std::size_t sequence = sequence_.load(std::memory_order_relaxed);
+
+    // Odd sequence marks a write in progress; release stores keep it ordered before every word written
+    sequence_.store(sequence + 1UL, std::memory_order_relaxed);
+    for (std::size_t i = 0; i < N_WORDS; ++i)
+    {
+      words_[i].store(words[i], std::memory_order_release);
+    }
+
+    sequence_.store(sequence + 2UL, std::memory_order_release);
+  }
+
+  /**
+   * @brief Returns last published value (reader side)
+   *
+   * @note Lock-free; retries only while a write is in progress
+   */
+  inline T load() const
+  {
+    WordType words[N_WORDS];
+    std::size_t sequence_before = 0UL;
+    std::size_t sequence_after = 0UL;
+    do
+    {
+      sequence_before = sequence_.load(std::memory_order_acquire);
+      // Acquire loads keep every word read ordered before the second sequence check
+      for (std::size_t i = 0; i < N_WORDS; ++i)
+      {
+        words[i] = words_[i].load(std::memory_order_acquire);
+      }
+      sequence_after = sequence_.load(std::memory_order_relaxed);
+    } while ((sequence_before & 1UL) or sequence_before != sequence_after);
+
+    T value;
+    std::memcpy(std::addressof(value), words, sizeof(T));
+    return value;
+  }
+
+private:
+  /// Word type used to hold the value
+  using WordType = std::size_t;
+
+  /// Number of words needed to hold the value
+  static constexpr std::size_t N_WORDS = (sizeof(T) + sizeof(WordType) - 1UL) / sizeof(WordType);
+
+  /// Write sequence counter; odd while a write is in progress
+  std::atomic<std::size_t> sequence_{0UL};
+
+  /// Value, as words
+  std::atomic<WordType> words_[N_WORDS];
+};
+
+}  // namespace flow
+
+#endif  // FLOW_UTILITY_SEQLOCK_HPP
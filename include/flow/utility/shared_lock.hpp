@@ -0,0 +1,54 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_UTILITY_SHARED_LOCK_HPP
+#define FLOW_UTILITY_SHARED_LOCK_HPP
+
+// C++ Standard Library
+#include <shared_mutex>
+#include <type_traits>
+#include <utility>
+
+namespace flow
+{
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/**
+ * @brief Checks if \p MutexT meets the <code>SharedLockable</code> requirements
+ */
+template <typename MutexT, typename = void> struct IsSharedLockable : std::false_type
+{};
+
+template <typename MutexT>
+struct IsSharedLockable<
+  MutexT,
+  std::conditional_t<
+    true,
+    void,
+    decltype(std::declval<MutexT&>().lock_shared(), std::declval<MutexT&>().unlock_shared())>> : std::true_type
+{};
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+
+/**
+ * @brief Lock used by read-only operations on data protected by a \p MutexT
+ *
+ * Resolves to <code>std::shared_lock<MutexT></code> when \p MutexT meets the <code>SharedLockable</code>
+ * requirements (e.g. <code>std::shared_timed_mutex</code>), so that readers do not serialize with each other;
+ * otherwise, resolves to \p ExclusiveLockT
+ *
+ * @tparam MutexT  mutex type
+ * @tparam ExclusiveLockT  lock type used by operations which modify data
+ */
+template <typename MutexT, typename ExclusiveLockT>
+using ReadLock =
+  std::conditional_t<detail::IsSharedLockable<MutexT>::value, std::shared_lock<MutexT>, ExclusiveLockT>;
+
+}  // namespace flow
+
+#endif  // FLOW_UTILITY_SHARED_LOCK_HPP
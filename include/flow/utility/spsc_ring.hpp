@@ -0,0 +1,142 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_UTILITY_SPSC_RING_HPP
+#define FLOW_UTILITY_SPSC_RING_HPP
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+// Flow
+#include <flow/utility/cache_line.hpp>
+#include <flow/utility/static_assert.hpp>
+
+namespace flow
+{
+
+/**
+ * @brief Bounded, wait-free, single-producer/single-consumer ring
+ *
+ * One thread may call <code>try_emplace</code> while another calls <code>consume_all</code>; neither call waits
+ * on the other. Elements are held in storage allocated once, on construction.
+ *
+ * @tparam T  element type
+ * @tparam N  capacity; must be a power of two
+ */
+template <typename T, std::size_t N> class SPSCRing
+{
+  FLOW_STATIC_ASSERT(N > 0UL and (N & (N - 1UL)) == 0UL, "'N' must be a power of two");
+
+public:
+  SPSCRing() : slots_{new Slot[N]} {}
+
+  SPSCRing(const SPSCRing&) = delete;
+
+  SPSCRing& operator=(const SPSCRing&) = delete;
+
+  ~SPSCRing()
+  {
+    consume_all([](T&&) {});
+  }
+
+  /**
+   * @brief Returns maximum number of elements
+   */
+  static constexpr std::size_t capacity() { return N; }
+
+  /**
+   * @brief Returns number of elements in ring
+   *
+   * @note Only a snapshot when called while the other side is active
+   */
+  inline std::size_t size() const
+  {
+    return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+  }
+
+  /**
+   * @brief Checks if ring has no elements
+   *
+   * @copydetails size
+   */
+  inline bool empty() const { return size() == 0UL; }
+
+  /**
+   * @brief Constructs a new element at the back of the ring (producer side)
+   *
+   * @param args  element constructor arguments
+   *
+   * @retval true  if element was added
+   * @retval false  if ring was full; no element is constructed
+   */
+  template <typename... ArgTs> inline bool try_emplace(ArgTs&&... args)
+  {
+    const std::size_t tail = tail_.load(std::memory_order_relaxed);
+    if (tail - head_.load(std::memory_order_acquire) == N)
+    {
+      return false;
+    }
+    new (slot(tail)) T{std::forward<ArgTs>(args)...};
+    tail_.store(tail + 1UL, std::memory_order_release);
+    return true;
+  }
+
+  /**
+   * @brief Moves all available elements, from oldest to newest, into a callback (consumer side)
+   *
+   * @param consume  callback invoked as <code>consume(T&& element)</code>
+   *
+   * @return number of consumed elements
+   *
+   * @note If \p consume throws, the element passed to it is discarded, and all later elements remain in the ring
+   */
+  template <typename ConsumeT> inline std::size_t consume_all(ConsumeT&& consume)
+  {
+    const std::size_t head = head_.load(std::memory_order_relaxed);
+    const std::size_t tail = tail_.load(std::memory_order_acquire);
+    for (std::size_t pos = head; pos != tail; ++pos)
+    {
+      T* const element = slot(pos);
+      try
+      {
+        consume(std::move(*element));
+      }
+      catch (...)
+      {
+        // Release elements consumed so far, so that none is consumed twice
+        element->~T();
+        head_.store(pos + 1UL, std::memory_order_release);
+        throw;
+      }
+      element->~T();
+    }
+    head_.store(tail, std::memory_order_release);
+    return tail - head;
+  }
+
+private:
+  /// Uninitialized storage for a single element
+  using Slot = std::aligned_storage_t<sizeof(T), alignof(T)>;
+
+  /// Returns pointer to storage for element at (unwrapped) position \p pos
+  inline T* slot(const std::size_t pos) { return reinterpret_cast<T*>(slots_.get() + (pos & (N - 1UL))); }
+
+  /// Element storage
+  std::unique_ptr<Slot[]> slots_;
+
+  /// Position of next element to consume; written by consumer only
+  alignas(CacheLineSize) std::atomic<std::size_t> head_{0UL};
+
+  /// Position of next element to produce; written by producer only
+  alignas(CacheLineSize) std::atomic<std::size_t> tail_{0UL};
+};
+
+}  // namespace flow
+
+#endif  // FLOW_UTILITY_SPSC_RING_HPP
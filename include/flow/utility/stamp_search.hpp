@@ -0,0 +1,415 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef FLOW_UTILITY_STAMP_SEARCH_HPP
+#define FLOW_UTILITY_STAMP_SEARCH_HPP
+
+// C++ Standard Library
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+// SIMD intrinsics (selected at compile time)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSE4_2__)
+#include <nmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace flow
+{
+
+/**
+ * @brief Helper struct used to map stamps onto a flat search key
+ *
+ * Stamp search kernels operate on contiguous arrays of keys. Keys must have the same ordering as the stamps they are
+ * derived from. Integral keys are searched using SIMD kernels, when available.
+ * \n
+ * May be specialized for custom stamp types with the same fields:
+ * - <code>key_type</code> : search key type
+ * - <code>get</code> : returns key associated with a stamp
+ *
+ * @tparam StampT  sequence stamp type
+ */
+template <typename StampT> struct StampKey
+{
+  /// Search key type
+  using key_type = StampT;
+
+  /// Returns search key associated with \p stamp
+  static constexpr const key_type& get(const StampT& stamp) { return stamp; }
+};
+
+#ifndef DOXYGEN_SKIP
+namespace detail
+{
+
+/// Window size below which stamp searches switch from binary search to a linear count
+static constexpr std::size_t STAMP_SEARCH_LINEAR_THRESHOLD = 64UL;
+
+
+/**
+ * @brief Counts keys less than \p key, without assuming order
+ */
+template <typename KeyT> inline std::size_t count_less(const KeyT* first, const std::size_t n, const KeyT& key)
+{
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    count += static_cast<std::size_t>(first[i] < key);
+  }
+  return count;
+}
+
+
+/**
+ * @brief Counts keys less than or equal to \p key, without assuming order
+ */
+template <typename KeyT> inline std::size_t count_less_equal(const KeyT* first, const std::size_t n, const KeyT& key)
+{
+  std::size_t count = 0;
+  for (std::size_t i = 0; i < n; ++i)
+  {
+    count += static_cast<std::size_t>(!(key < first[i]));
+  }
+  return count;
+}
+
+/**
+ * @brief Counts 32-bit keys which are less than (or greater than) \p key
+ *
+ * Keys are offset by \p bias before being compared as signed values, which allows unsigned keys to be compared with
+ * signed comparison instructions
+ *
+ * @tparam CountLess  counts <code>key > element</code> if true; otherwise counts <code>element > key</code>
+ */
+template <bool CountLess>
+inline std::size_t
+count_compare_32(const std::int32_t* first, const std::size_t n, const std::int32_t key, const std::int32_t bias)
+{
+  const std::int32_t biased_key = key ^ bias;
+
+  std::size_t i = 0;
+  std::size_t count = 0;
+
+#if defined(__AVX2__)
+  const __m256i bias_v = _mm256_set1_epi32(bias);
+  const __m256i key_v = _mm256_set1_epi32(biased_key);
+  __m256i count_v = _mm256_setzero_si256();
+  for (; i + 8UL <= n; i += 8UL)
+  {
+    const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i)), bias_v);
+    count_v = _mm256_sub_epi32(count_v, CountLess ? _mm256_cmpgt_epi32(key_v, x) : _mm256_cmpgt_epi32(x, key_v));
+  }
+
+  alignas(32) std::int32_t lanes[8];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), count_v);
+  for (const auto lane : lanes)
+  {
+    count += static_cast<std::size_t>(lane);
+  }
+#elif defined(__SSE2__)
+  const __m128i bias_v = _mm_set1_epi32(bias);
+  const __m128i key_v = _mm_set1_epi32(biased_key);
+  __m128i count_v = _mm_setzero_si128();
+  for (; i + 4UL <= n; i += 4UL)
+  {
+    const __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i)), bias_v);
+    count_v = _mm_sub_epi32(count_v, CountLess ? _mm_cmpgt_epi32(key_v, x) : _mm_cmpgt_epi32(x, key_v));
+  }
+
+  alignas(16) std::int32_t lanes[4];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), count_v);
+  for (const auto lane : lanes)
+  {
+    count += static_cast<std::size_t>(lane);
+  }
+#endif
+
+  for (; i < n; ++i)
+  {
+    const std::int32_t x = first[i] ^ bias;
+    count += static_cast<std::size_t>(CountLess ? (biased_key > x) : (x > biased_key));
+  }
+  return count;
+}
+
+
+/**
+ * @copydoc count_compare_32
+ */
+template <bool CountLess>
+inline std::size_t
+count_compare_64(const std::int64_t* first, const std::size_t n, const std::int64_t key, const std::int64_t bias)
+{
+  const std::int64_t biased_key = key ^ bias;
+
+  std::size_t i = 0;
+  std::size_t count = 0;
+
+#if defined(__AVX2__)
+  const __m256i bias_v = _mm256_set1_epi64x(bias);
+  const __m256i key_v = _mm256_set1_epi64x(biased_key);
+  __m256i count_v = _mm256_setzero_si256();
+  for (; i + 4UL <= n; i += 4UL)
+  {
+    const __m256i x = _mm256_xor_si256(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(first + i)), bias_v);
+    count_v = _mm256_sub_epi64(count_v, CountLess ? _mm256_cmpgt_epi64(key_v, x) : _mm256_cmpgt_epi64(x, key_v));
+  }
+
+  alignas(32) std::int64_t lanes[4];
+  _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), count_v);
+  for (const auto lane : lanes)
+  {
+    count += static_cast<std::size_t>(lane);
+  }
+#elif defined(__SSE4_2__)
+  // NOTE: SSE2 lacks 64-bit comparisons; emulating them is slower than the scalar loop
+  const __m128i bias_v = _mm_set1_epi64x(bias);
+  const __m128i key_v = _mm_set1_epi64x(biased_key);
+  __m128i count_v = _mm_setzero_si128();
+  for (; i + 2UL <= n; i += 2UL)
+  {
+    const __m128i x = _mm_xor_si128(_mm_loadu_si128(reinterpret_cast<const __m128i*>(first + i)), bias_v);
+    count_v = _mm_sub_epi64(count_v, CountLess ? _mm_cmpgt_epi64(key_v, x) : _mm_cmpgt_epi64(x, key_v));
+  }
+
+  alignas(16) std::int64_t lanes[2];
+  _mm_store_si128(reinterpret_cast<__m128i*>(lanes), count_v);
+  for (const auto lane : lanes)
+  {
+    count += static_cast<std::size_t>(lane);
+  }
+#endif
+
+  for (; i < n; ++i)
+  {
+    const std::int64_t x = first[i] ^ bias;
+    count += static_cast<std::size_t>(CountLess ? (biased_key > x) : (x > biased_key));
+  }
+  return count;
+}
+
+
+inline std::size_t count_less(const std::int32_t* first, const std::size_t n, const std::int32_t key)
+{
+  return count_compare_32<true>(first, n, key, 0);
+}
+
+
+inline std::size_t count_less(const std::uint32_t* first, const std::size_t n, const std::uint32_t key)
+{
+  return count_compare_32<true>(
+    reinterpret_cast<const std::int32_t*>(first),
+    n,
+    static_cast<std::int32_t>(key),
+    std::numeric_limits<std::int32_t>::min());
+}
+
+
+inline std::size_t count_less(const std::int64_t* first, const std::size_t n, const std::int64_t key)
+{
+  return count_compare_64<true>(first, n, key, 0);
+}
+
+
+inline std::size_t count_less(const std::uint64_t* first, const std::size_t n, const std::uint64_t key)
+{
+  return count_compare_64<true>(
+    reinterpret_cast<const std::int64_t*>(first),
+    n,
+    static_cast<std::int64_t>(key),
+    std::numeric_limits<std::int64_t>::min());
+}
+
+
+inline std::size_t count_less_equal(const std::int32_t* first, const std::size_t n, const std::int32_t key)
+{
+  return n - count_compare_32<false>(first, n, key, 0);
+}
+
+
+inline std::size_t count_less_equal(const std::uint32_t* first, const std::size_t n, const std::uint32_t key)
+{
+  return n - count_compare_32<false>(
+               reinterpret_cast<const std::int32_t*>(first),
+               n,
+               static_cast<std::int32_t>(key),
+               std::numeric_limits<std::int32_t>::min());
+}
+
+
+inline std::size_t count_less_equal(const std::int64_t* first, const std::size_t n, const std::int64_t key)
+{
+  return n - count_compare_64<false>(first, n, key, 0);
+}
+
+
+inline std::size_t count_less_equal(const std::uint64_t* first, const std::size_t n, const std::uint64_t key)
+{
+  return n - count_compare_64<false>(
+               reinterpret_cast<const std::int64_t*>(first),
+               n,
+               static_cast<std::int64_t>(key),
+               std::numeric_limits<std::int64_t>::min());
+}
+
+}  // namespace detail
+#endif  // DOXYGEN_SKIP
+
+
+/**
+ * @brief Returns the number of elements in a sorted key range which are less than \p key
+ *
+ * Equivalent to the position of <code>std::lower_bound</code>. Narrows the search range with a binary search, then
+ * finishes with a linear (SIMD, where available) count over a small window of keys.
+ *
+ * @param first  pointer to first key
+ * @param n  number of keys
+ * @param key  search key
+ */
+template <typename KeyT> inline std::size_t stamp_lower_bound(const KeyT* first, std::size_t n, const KeyT& key)
+{
+  const KeyT* const origin = first;
+
+  // Narrow search window
+  while (n > detail::STAMP_SEARCH_LINEAR_THRESHOLD)
+  {
+    const std::size_t half = n / 2UL;
+    if (first[half] < key)
+    {
+      first += half + 1UL;
+      n -= half + 1UL;
+    }
+    else
+    {
+      n = half;
+    }
+  }
+
+  // Count remaining elements before key
+  return static_cast<std::size_t>(first - origin) + detail::count_less(first, n, key);
+}
+
+
+/**
+ * @brief Returns the number of elements in a sorted key range which are less than or equal to \p key
+ *
+ * Equivalent to the position of <code>std::upper_bound</code>
+ *
+ * @copydetails stamp_lower_bound
+ */
+template <typename KeyT> inline std::size_t stamp_upper_bound(const KeyT* first, std::size_t n, const KeyT& key)
+{
+  const KeyT* const origin = first;
+
+  // Narrow search window
+  while (n > detail::STAMP_SEARCH_LINEAR_THRESHOLD)
+  {
+    const std::size_t half = n / 2UL;
+    if (!(key < first[half]))
+    {
+      first += half + 1UL;
+      n -= half + 1UL;
+    }
+    else
+    {
+      n = half;
+    }
+  }
+
+  // Count remaining elements at or before key
+  return static_cast<std::size_t>(first - origin) + detail::count_less_equal(first, n, key);
+}
+
+
+/**
+ * @brief Returns the number of elements in a sorted key range which are less than or equal to \p key, searching
+ *        backwards from the last key
+ *
+ * Equivalent to <code>stamp_upper_bound</code>. Brackets the result by galloping backwards from the last key in
+ * exponentially growing steps, then searches within that bracket, such that cost scales with the distance of the
+ * result from the back of the range rather than with the size of the range.
+ *
+ * @copydetails stamp_lower_bound
+ */
+template <typename KeyT>
+inline std::size_t stamp_upper_bound_from_back(const KeyT* first, const std::size_t n, const KeyT& key)
+{
+  std::size_t last = n;
+  std::size_t step = 1UL;
+  while (last > step)
+  {
+    const std::size_t probe = last - step;
+    if (!(key < first[probe]))
+    {
+      return probe + 1UL + stamp_upper_bound(first + probe + 1UL, last - probe - 1UL, key);
+    }
+    last = probe;
+    step *= 2UL;
+  }
+  return stamp_upper_bound(first, last, key);
+}
+
+
+/**
+ * @brief Returns the number of elements in a sorted key range which are less than \p key, searching forwards from the
+ *        first key
+ *
+ * Equivalent to <code>stamp_lower_bound</code>. Brackets the result by galloping forwards from the first key in
+ * exponentially growing steps, then searches within that bracket, such that cost scales with the distance of the
+ * result from the front of the range rather than with the size of the range.
+ *
+ * @copydetails stamp_lower_bound
+ */
+template <typename KeyT>
+inline std::size_t stamp_lower_bound_from_front(const KeyT* first, const std::size_t n, const KeyT& key)
+{
+  std::size_t offset = 0UL;
+  std::size_t step = 1UL;
+  while ((n - offset) > step)
+  {
+    const std::size_t probe = offset + step - 1UL;
+    if (!(first[probe] < key))
+    {
+      return offset + stamp_lower_bound(first + offset, probe - offset, key);
+    }
+    offset = probe + 1UL;
+    step *= 2UL;
+  }
+  return offset + stamp_lower_bound(first + offset, n - offset, key);
+}
+
+
+/**
+ * @brief Returns the number of elements in a sorted key range which are less than or equal to \p key, searching
+ *        forwards from the first key
+ *
+ * Equivalent to <code>stamp_upper_bound</code>
+ *
+ * @copydetails stamp_lower_bound_from_front
+ */
+template <typename KeyT>
+inline std::size_t stamp_upper_bound_from_front(const KeyT* first, const std::size_t n, const KeyT& key)
+{
+  std::size_t offset = 0UL;
+  std::size_t step = 1UL;
+  while ((n - offset) > step)
+  {
+    const std::size_t probe = offset + step - 1UL;
+    if (key < first[probe])
+    {
+      return offset + stamp_upper_bound(first + offset, probe - offset, key);
+    }
+    offset = probe + 1UL;
+    step *= 2UL;
+  }
+  return offset + stamp_upper_bound(first + offset, n - offset, key);
+}
+
+}  // namespace flow
+
+#endif  // FLOW_UTILITY_STAMP_SEARCH_HPP
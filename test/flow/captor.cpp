@@ -5,9 +5,18 @@
 #ifndef DOXYGEN_SKIP
 
 // C++ Standard Library
+#include <algorithm>
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <deque>
 #include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <stdexcept>
+#include <string>
 #include <thread>
+#include <utility>
 #include <vector>
 
 // GTest
@@ -15,11 +24,21 @@
 
 // Flow
 #include <flow/captor.hpp>
+#include <flow/captor/lockable.hpp>
+#include <flow/captor/mpsc.hpp>
 #include <flow/captor/nolock.hpp>
+#include <flow/captor/polling.hpp>
+#include <flow/captor/spsc.hpp>
 #include <flow/captor_state.hpp>
 #include <flow/captor_state_ostream.hpp>
+#include <flow/container/ring_buffer.hpp>
+#include <flow/driver/batch.hpp>
 #include <flow/driver/next.hpp>
+#include <flow/driver/throttled.hpp>
 #include <flow/follower/before.hpp>
+#include <flow/follower/matched_stamp.hpp>
+#include <flow/follower/ranged.hpp>
+#include <flow/utility/adaptive_mutex.hpp>
 
 
 using namespace flow;
@@ -112,4 +131,948 @@ TEST(Captor, SimpleQueueMonitorSkipState)
   ASSERT_EQ(state, State::SKIP_FRAME_QUEUE_PRECONDITION);
 }
 
+
+template <typename CaptorT> std::vector<std::pair<int, int>> captor_contents(CaptorT& captor)
+{
+  std::vector<std::pair<int, int>> contents;
+  captor.inspect([&contents](const Dispatch<int, int>& dispatch) {
+    contents.emplace_back(dispatch.stamp, dispatch.value);
+  });
+  return contents;
+}
+
+
+TEST(Captor, InsertRangeMatchesSequentialInject)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  std::vector<DispatchType> dispatches;
+  for (int i = 0; i < 200; ++i)
+  {
+    dispatches.emplace_back((i * 37) % 101, i);
+  }
+
+  driver::Next<DispatchType, NoLock> sequential{};
+  driver::Next<DispatchType, NoLock> bulk{};
+  driver::Next<DispatchType> bulk_locked{};
+
+  sequential.set_capacity(20);
+  bulk.set_capacity(20);
+  bulk_locked.set_capacity(20);
+
+  sequential.inject(50, -1);
+  bulk.inject(50, -1);
+  bulk_locked.inject(50, -1);
+
+  for (const auto& dispatch : dispatches)
+  {
+    sequential.inject(dispatch);
+  }
+  bulk.insert(dispatches.begin(), dispatches.end());
+  bulk_locked.insert(dispatches.begin(), dispatches.end());
+
+  const auto expected = captor_contents(sequential);
+  ASSERT_EQ(expected.size(), 20UL);
+  EXPECT_EQ(captor_contents(bulk), expected);
+  EXPECT_EQ(captor_contents(bulk_locked), expected);
+}
+
+/// Value which counts how many times it has been copied
+struct CopyCounted
+{
+  explicit CopyCounted(std::size_t* const _copies) : copies{_copies} {}
+
+  CopyCounted(const CopyCounted& other) : copies{other.copies} { ++(*copies); }
+
+  CopyCounted(CopyCounted&& other) = default;
+
+  CopyCounted& operator=(const CopyCounted& other)
+  {
+    copies = other.copies;
+    ++(*copies);
+    return *this;
+  }
+
+  CopyCounted& operator=(CopyCounted&& other) = default;
+
+  std::size_t* copies;
+};
+
+
+template <typename LockPolicyT> void insert_range_copies_each_element_once(const AdmissionPolicy admission_policy)
+{
+  using DispatchType = Dispatch<int, CopyCounted>;
+
+  std::size_t copies = 0UL;
+  std::vector<DispatchType> dispatches;
+  for (int t : {3, 1, 4, 0, 2})
+  {
+    dispatches.emplace_back(t, CopyCounted{&copies});
+  }
+  ASSERT_EQ(copies, 0UL);
+
+  driver::Next<DispatchType, LockPolicyT> captor;
+  captor.set_admission_policy(admission_policy);
+  captor.inject(5, CopyCounted{&copies});
+  captor.insert(dispatches.begin(), dispatches.end());
+
+  EXPECT_EQ(captor.size(), 6UL);
+  EXPECT_EQ(copies, dispatches.size());
+}
+
+
+TEST(Captor, InsertRangeCopiesEachElementOnce)
+{
+  insert_range_copies_each_element_once<NoLock>(AdmissionPolicy::DROP_OLDEST);
+  insert_range_copies_each_element_once<NoLock>(AdmissionPolicy::REJECT_INCOMING);
+  insert_range_copies_each_element_once<std::unique_lock<std::mutex>>(AdmissionPolicy::DROP_OLDEST);
+  insert_range_copies_each_element_once<std::unique_lock<std::mutex>>(AdmissionPolicy::REJECT_INCOMING);
+  insert_range_copies_each_element_once<PollingLock<std::lock_guard<std::mutex>>>(AdmissionPolicy::DROP_OLDEST);
+}
+
+TEST(Captor, AdmissionPolicyDropOldest)
+{
+  driver::Next<Dispatch<int, int>, NoLock> captor;
+  captor.set_capacity(3);
+  ASSERT_EQ(captor.get_admission_policy(), AdmissionPolicy::DROP_OLDEST);
+
+  for (int t : {1, 2, 3, 4, 0, 3})
+  {
+    captor.inject(t, t);
+  }
+
+  const std::vector<std::pair<int, int>> expected{{2, 2}, {3, 3}, {4, 4}};
+  EXPECT_EQ(captor_contents(captor), expected);
+  EXPECT_EQ(captor.get_admission_stats().dropped, 2UL);
+  EXPECT_EQ(captor.get_admission_stats().rejected, 0UL);
+}
+
+TEST(Captor, AdmissionPolicyRejectIncoming)
+{
+  driver::Next<Dispatch<int, int>> captor;
+  captor.set_capacity(3);
+  captor.set_admission_policy(AdmissionPolicy::REJECT_INCOMING);
+  ASSERT_EQ(captor.get_admission_policy(), AdmissionPolicy::REJECT_INCOMING);
+
+  for (int t : {1, 2, 3, 4, 0})
+  {
+    captor.inject(Dispatch<int, int>{t, t});
+  }
+
+  const std::vector<std::pair<int, int>> expected{{1, 1}, {2, 2}, {3, 3}};
+  EXPECT_EQ(captor_contents(captor), expected);
+  EXPECT_EQ(captor.get_admission_stats().dropped, 0UL);
+  EXPECT_EQ(captor.get_admission_stats().rejected, 2UL);
+}
+
+TEST(Captor, AdmissionPolicyRejectIfOlderThanFront)
+{
+  driver::Next<Dispatch<int, int>, NoLock> captor;
+  captor.set_capacity(3);
+  captor.set_admission_policy(AdmissionPolicy::REJECT_IF_OLDER_THAN_FRONT);
+
+  const std::vector<Dispatch<int, int>> dispatches{
+    Dispatch<int, int>{5, 5}, Dispatch<int, int>{4, 4}, Dispatch<int, int>{6, 6}};
+  captor.insert(dispatches.begin(), dispatches.end());
+  captor.inject(3, 3);
+  captor.inject(7, 7);
+  captor.inject(8, 8);
+
+  const std::vector<std::pair<int, int>> expected{{6, 6}, {7, 7}, {8, 8}};
+  EXPECT_EQ(captor_contents(captor), expected);
+  EXPECT_EQ(captor.get_admission_stats().dropped, 2UL);
+  EXPECT_EQ(captor.get_admission_stats().rejected, 1UL);
+}
+
+TEST(Captor, AdmissionPolicyRejectIfOlderThanFrontWithoutCapacity)
+{
+  driver::Next<Dispatch<int, int>, NoLock> captor;
+  captor.set_admission_policy(AdmissionPolicy::REJECT_IF_OLDER_THAN_FRONT);
+
+  for (int t : {2, 1, 3, 2})
+  {
+    captor.inject(t, t);
+  }
+
+  const std::vector<std::pair<int, int>> expected{{2, 2}, {3, 3}};
+  EXPECT_EQ(captor_contents(captor), expected);
+  EXPECT_EQ(captor.get_admission_stats().rejected, 1UL);
+}
+
+struct ConstructionCounted
+{
+  static int count;
+
+  explicit ConstructionCounted(int) { ++count; }
+};
+
+int ConstructionCounted::count = 0;
+
+TEST(Captor, AdmissionCheckedBeforeConstruction)
+{
+  driver::Next<Dispatch<int, ConstructionCounted>, NoLock> captor;
+  captor.set_capacity(2);
+  captor.set_admission_policy(AdmissionPolicy::REJECT_INCOMING);
+
+  ConstructionCounted::count = 0;
+  for (int t = 0; t < 5; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  EXPECT_EQ(ConstructionCounted::count, 2);
+  EXPECT_EQ(captor.get_admission_stats().rejected, 3UL);
+}
+
+
+TEST(Captor, CaptureViewReferencesQueuedData)
+{
+  driver::Batch<Dispatch<int, int>, NoLock> captor{3};
+  for (int t = 0; t < 5; ++t)
+  {
+    captor.inject(t, t * 10);
+  }
+
+  std::vector<const Dispatch<int, int>*> queued;
+  captor.inspect([&queued](const Dispatch<int, int>& dispatch) { queued.push_back(&dispatch); });
+
+  State state;
+  decltype(captor)::view_type view;
+  CaptureRange<int> range;
+  std::tie(state, view) = captor.capture_view(range);
+
+  ASSERT_EQ(state, State::PRIMED);
+  ASSERT_TRUE(view.leased());
+  ASSERT_EQ(view.size(), 3UL);
+
+  auto queued_itr = queued.begin();
+  for (const auto& dispatch : view)
+  {
+    EXPECT_EQ(&dispatch, *queued_itr++);
+  }
+  EXPECT_EQ(range.lower_stamp, 0);
+  EXPECT_EQ(range.upper_stamp, 2);
+}
+
+
+TEST(Captor, CaptureViewDefersQueueChangesUntilRelease)
+{
+  driver::Batch<Dispatch<int, int>, NoLock> captor{3};
+  driver::Batch<Dispatch<int, int>, NoLock> copy_captor{3};
+  for (int t = 0; t < 5; ++t)
+  {
+    captor.inject(t, t);
+    copy_captor.inject(t, t);
+  }
+
+  std::vector<Dispatch<int, int>> captured;
+  CaptureRange<int> copy_range;
+  ASSERT_EQ(std::get<0>(copy_captor.capture(std::back_inserter(captured), copy_range)), State::PRIMED);
+  copy_captor.inject(5, 5);
+  copy_captor.remove(2);
+
+  CaptureRange<int> range;
+  auto view = std::get<1>(captor.capture_view(range));
+  const auto leased_contents = captor_contents(captor);
+  captor.inject(5, 5);
+  captor.remove(2);
+
+  // Queue is frozen while leased
+  EXPECT_EQ(captor_contents(captor), leased_contents);
+  ASSERT_TRUE(std::equal(
+    view.begin(), view.end(), captured.begin(), captured.end(), [](const auto& lhs, const auto& rhs) {
+      return lhs.stamp == rhs.stamp and lhs.value == rhs.value;
+    }));
+
+  view.release();
+  EXPECT_FALSE(view.leased());
+  EXPECT_TRUE(view.empty());
+  EXPECT_EQ(captor_contents(captor), captor_contents(copy_captor));
+}
+
+
+TEST(Captor, CaptureViewReleasedOnNextCapture)
+{
+  driver::Batch<Dispatch<int, int>, NoLock> captor{2};
+  for (int t = 0; t < 4; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  CaptureRange<int> range;
+  auto first_view = std::get<1>(captor.capture_view(range));
+  ASSERT_EQ(first_view.begin()->stamp, 0);
+
+  auto second_view = std::get<1>(captor.capture_view(range));
+  ASSERT_EQ(second_view.size(), 2UL);
+  EXPECT_EQ(second_view.begin()->stamp, 1);
+
+  // Stale view does not release newer lease
+  first_view.release();
+  captor.inject(4, 4);
+  EXPECT_EQ(captor.size(), 3UL);
+
+  second_view.release();
+  EXPECT_EQ(captor.size(), 3UL);
+  EXPECT_EQ(captor_contents(captor).front().first, 2);
+}
+
+
+TEST(Captor, CaptureViewWithoutDataIsNotLeased)
+{
+  driver::Batch<Dispatch<int, int>, NoLock> captor{3};
+  captor.inject(0, 0);
+
+  CaptureRange<int> range;
+  const auto result = captor.capture_view(range);
+  EXPECT_EQ(std::get<0>(result), State::RETRY);
+  EXPECT_FALSE(std::get<1>(result).leased());
+
+  captor.inject(1, 1);
+  EXPECT_EQ(captor.size(), 2UL);
+}
+
+
+TEST(Captor, CaptureViewLockableDefersReset)
+{
+  driver::Next<Dispatch<int, int>, std::unique_lock<std::mutex>> captor;
+  captor.inject(0, 0);
+  captor.inject(1, 1);
+
+  CaptureRange<int> range;
+  auto view = std::get<1>(captor.capture_view(range, std::chrono::steady_clock::time_point::max()));
+  ASSERT_EQ(view.size(), 1UL);
+
+  captor.reset();
+  captor.inject(2, 2);
+  EXPECT_EQ(captor.size(), 2UL);
+  EXPECT_EQ(view.begin()->stamp, 0);
+
+  view.release();
+  ASSERT_EQ(captor.size(), 1UL);
+  EXPECT_EQ(captor_contents(captor).front().first, 2);
+}
+
+
+TEST(Captor, CaptureViewLockableReleasedOnNextCapture)
+{
+  driver::Next<Dispatch<int, int>, std::unique_lock<std::mutex>> captor;
+  captor.inject(0, 0);
+
+  CaptureRange<int> range;
+  auto view = std::get<1>(captor.capture_view(range, std::chrono::steady_clock::time_point::max()));
+  ASSERT_TRUE(view.leased());
+
+  std::thread producer{[&captor] { captor.inject(1, 1); }};
+  producer.join();
+  EXPECT_EQ(captor.size(), 1UL);
+
+  // Next capture releases lease, then waits for deferred data
+  std::vector<Dispatch<int, int>> captured;
+  const auto state = std::get<0>(
+    captor.capture(std::back_inserter(captured), range, std::chrono::steady_clock::now() + std::chrono::seconds{1}));
+  ASSERT_EQ(state, State::PRIMED);
+  ASSERT_EQ(captured.size(), 1UL);
+  EXPECT_EQ(captured.front().stamp, 1);
+  EXPECT_FALSE(captor.size());
+}
+
+
+TEST(Captor, SPSCLaneDrainsOnCapture)
+{
+  driver::Next<Dispatch<int, int>, SPSCLane<8>> captor;
+  captor.inject(1, 1);
+  captor.inject(0, 0);
+  EXPECT_EQ(captor.size(), 2UL);
+
+  // Data waiting in the lane is not yet queued
+  EXPECT_TRUE(captor_contents(captor).empty());
+
+  std::vector<Dispatch<int, int>> captured;
+  CaptureRange<int> range;
+  ASSERT_EQ(std::get<0>(captor.capture(std::back_inserter(captured), range)), State::PRIMED);
+  ASSERT_EQ(captured.size(), 1UL);
+  EXPECT_EQ(captured.front().stamp, 0);
+  EXPECT_EQ(captor_contents(captor), (std::vector<std::pair<int, int>>{{1, 1}}));
+}
+
+
+TEST(Captor, SPSCLaneRejectsWhenFull)
+{
+  driver::Next<Dispatch<int, int>, SPSCLane<4>> captor;
+  for (int t = 0; t < 6; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  EXPECT_EQ(captor.size(), 4UL);
+  EXPECT_EQ(captor.get_admission_stats().rejected, 2UL);
+}
+
+
+TEST(Captor, SPSCLaneRemoveDrainsFirst)
+{
+  driver::Next<Dispatch<int, int>, SPSCLane<8>> captor;
+  for (int t = 0; t < 4; ++t)
+  {
+    captor.inject(t, t);
+  }
+  captor.remove(2);
+
+  EXPECT_EQ(captor_contents(captor), (std::vector<std::pair<int, int>>{{2, 2}, {3, 3}}));
+}
+
+
+TEST(Captor, SPSCLaneRecoversFromFailedDrain)
+{
+  using DispatchType = Dispatch<int, std::string>;
+
+  // Fixed-size container throws when the lane drains more elements than it can hold
+  driver::Next<DispatchType, SPSCLane<8>, RingBuffer<DispatchType, 2>> captor;
+  for (int t = 0; t < 3; ++t)
+  {
+    captor.inject(t, std::to_string(t));
+  }
+  EXPECT_THROW(captor.remove(-1), std::length_error);
+  ASSERT_EQ(captor.size(), 2UL);
+
+  // No element is drained twice, and later elements are drained once there is room for them
+  for (int t = 3; t < 7; ++t)
+  {
+    std::vector<DispatchType> data;
+    CaptureRange<int> range;
+    ASSERT_EQ(captor.capture(std::back_inserter(data), range), State::PRIMED);
+    ASSERT_EQ(data.size(), 1UL);
+    EXPECT_EQ(data.front().value, std::to_string(data.front().stamp));
+    captor.inject(t, std::to_string(t));
+  }
+  EXPECT_LE(captor.size(), 2UL);
+}
+
+
+TEST(Captor, SPSCLaneProducerThread)
+{
+  static constexpr int N = 10000;
+
+  driver::Next<Dispatch<int, int>, SPSCLane<64>> captor;
+
+  std::thread producer{[&captor] {
+    for (int t = 0; t < N; ++t)
+    {
+      captor.inject(t, t);
+      if (t % 32 == 31)
+      {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  std::vector<Dispatch<int, int>> captured;
+  // Data may be rejected if the lane fills before it is drained
+  while (captured.size() + captor.get_admission_stats().rejected < static_cast<std::size_t>(N))
+  {
+    CaptureRange<int> range;
+    if (std::get<0>(captor.capture(std::back_inserter(captured), range)) != State::PRIMED)
+    {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  ASSERT_EQ(captured.size() + captor.get_admission_stats().rejected, static_cast<std::size_t>(N));
+  EXPECT_TRUE(std::is_sorted(captured.begin(), captured.end(), [](const auto& lhs, const auto& rhs) {
+    return lhs.stamp < rhs.stamp;
+  }));
+}
+
+TEST(Captor, MPSCLaneMergesInStampOrder)
+{
+  driver::Next<Dispatch<int, int>, MPSCLane<8>> captor;
+  captor.inject(2, 2);
+  captor.inject(0, 0);
+  captor.inject(1, 1);
+  EXPECT_EQ(captor.size(), 3UL);
+
+  captor.remove(0);
+  EXPECT_EQ(captor_contents(captor), (std::vector<std::pair<int, int>>{{0, 0}, {1, 1}, {2, 2}}));
+}
+
+
+TEST(Captor, MPSCLaneRecoversFromFailedDrain)
+{
+  using DispatchType = Dispatch<int, std::string>;
+
+  // Fixed-size container throws when the lane drains more elements than it can hold
+  driver::Next<DispatchType, MPSCLane<8>, RingBuffer<DispatchType, 2>> captor;
+  for (int t = 0; t < 3; ++t)
+  {
+    captor.inject(t, std::to_string(t));
+  }
+  EXPECT_THROW(captor.remove(-1), std::length_error);
+  ASSERT_EQ(captor.size(), 2UL);
+
+  // Lane is not wedged; later elements are drained once there is room for them
+  for (int t = 3; t < 7; ++t)
+  {
+    std::vector<DispatchType> data;
+    CaptureRange<int> range;
+    ASSERT_EQ(captor.capture(std::back_inserter(data), range), State::PRIMED);
+    captor.inject(t, std::to_string(t));
+  }
+  EXPECT_LE(captor.size(), 2UL);
+}
+
+
+TEST(Captor, MPSCLaneProducerThreads)
+{
+  static constexpr int N = 1000;
+  static constexpr int P = 4;
+
+  // Lane is large enough to hold all data, so nothing is rejected
+  driver::Next<Dispatch<int, int>, MPSCLane<4096>> captor;
+
+  std::vector<std::thread> producers;
+  for (int p = 0; p < P; ++p)
+  {
+    producers.emplace_back([&captor, p] {
+      for (int t = p; t < N * P; t += P)
+      {
+        captor.inject(t, t);
+      }
+    });
+  }
+
+  std::vector<Dispatch<int, int>> captured;
+  while (captured.size() < static_cast<std::size_t>(N * P))
+  {
+    CaptureRange<int> range;
+    if (std::get<0>(captor.capture(std::back_inserter(captured), range)) != State::PRIMED)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  for (auto& producer : producers)
+  {
+    producer.join();
+  }
+
+  EXPECT_EQ(captor.get_admission_stats().rejected, 0UL);
+
+  std::vector<int> stamps;
+  std::transform(captured.begin(), captured.end(), std::back_inserter(stamps), [](const auto& dispatch) {
+    return dispatch.stamp;
+  });
+  std::sort(stamps.begin(), stamps.end());
+  for (int t = 0; t < N * P; ++t)
+  {
+    ASSERT_EQ(stamps[t], t);
+  }
+}
+
+TEST(WakeThreshold, DefaultIsAlwaysMet)
+{
+  DispatchQueue<Dispatch<int, int>, std::deque<Dispatch<int, int>>> queue;
+  EXPECT_TRUE(WakeThreshold<int>{}.is_met(queue));
+}
+
+
+TEST(WakeThreshold, MinSizeAndNewestStamp)
+{
+  DispatchQueue<Dispatch<int, int>, std::deque<Dispatch<int, int>>> queue;
+  const WakeThreshold<int> threshold{2UL, 5};
+
+  queue.insert(6, 6);
+  EXPECT_FALSE(threshold.is_met(queue));
+
+  queue.insert(1, 1);
+  EXPECT_TRUE(threshold.is_met(queue));
+
+  queue.remove_before(6);
+  queue.insert(4, 4);
+  EXPECT_TRUE(threshold.is_met(queue));
+
+  queue.remove_before(5);
+  queue.insert(7, 7);
+  queue.remove_before(7);
+  queue.insert(2, 2);
+  EXPECT_EQ(queue.newest_stamp(), 7);
+  EXPECT_TRUE(threshold.is_met(queue));
+
+  queue.clear();
+  queue.insert(1, 1);
+  queue.insert(2, 2);
+  EXPECT_FALSE(threshold.is_met(queue));
+}
+
+
+TEST(Captor, WaitingBatchCaptureWakesWhenReady)
+{
+  driver::Batch<Dispatch<int, int>, std::unique_lock<std::mutex>> captor{3};
+
+  std::vector<Dispatch<int, int>> captured;
+  std::thread consumer{[&captor, &captured] {
+    CaptureRange<int> range;
+    const auto result = captor.capture(
+      std::back_inserter(captured), range, std::chrono::steady_clock::now() + std::chrono::seconds{5});
+    EXPECT_EQ(std::get<0>(result), State::PRIMED);
+  }};
+
+  for (int t = 0; t < 3; ++t)
+  {
+    captor.inject(t, t);
+  }
+  consumer.join();
+
+  ASSERT_EQ(captured.size(), 3UL);
+  EXPECT_EQ(captured.back().stamp, 2);
+}
+
+
+/**
+ * Runs a blocking capture while \p inject_below adds data below its wake threshold, which must time out, then runs
+ * a blocking capture while \p inject_at adds data at the threshold, which must wake it; returns the second state
+ */
+template <typename CaptorT, typename CaptureRangeT, typename InjectBelowT, typename InjectAtT>
+State capture_across_wake_threshold(
+  CaptorT& captor,
+  CaptureRangeT& range,
+  std::vector<Dispatch<int, int>>& captured,
+  InjectBelowT inject_below,
+  InjectAtT inject_at)
+{
+  State below_state{State::RETRY};
+  {
+    std::thread consumer{[&] {
+      below_state = std::get<0>(captor.capture(
+        std::back_inserter(captured), range, std::chrono::steady_clock::now() + std::chrono::milliseconds{100}));
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    inject_below();
+    consumer.join();
+  }
+  EXPECT_EQ(below_state, State::TIMEOUT);
+
+  // A lost wakeup leaves this capture waiting until it times out
+  State at_state{State::RETRY};
+  {
+    std::thread consumer{[&] {
+      at_state = std::get<0>(
+        captor.capture(std::back_inserter(captured), range, std::chrono::steady_clock::now() + std::chrono::seconds{5}));
+    }};
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    inject_at();
+    consumer.join();
+  }
+  return at_state;
+}
+
+
+TEST(Captor, WaitingThrottledCaptureWakesAfterThrottlePeriod)
+{
+  driver::Throttled<Dispatch<int, int>, std::unique_lock<std::mutex>> captor{10};
+
+  std::vector<Dispatch<int, int>> captured;
+  CaptureRange<int> range;
+  captor.inject(0, 0);
+  ASSERT_EQ(
+    std::get<0>(captor.capture(std::back_inserter(captured), range, std::chrono::steady_clock::time_point::min())),
+    State::PRIMED);
+  captured.clear();
+
+  // Next capture needs an element at least one throttle period after the last
+  const State state = capture_across_wake_threshold(
+    captor, range, captured, [&captor] { captor.inject(9, 9); }, [&captor] { captor.inject(10, 10); });
+
+  ASSERT_EQ(state, State::PRIMED);
+  ASSERT_EQ(captured.size(), 1UL);
+  EXPECT_EQ(captured.front().stamp, 10);
+}
+
+
+TEST(Captor, WaitingBeforeCaptureWakesAtDelayedBoundary)
+{
+  follower::Before<Dispatch<int, int>, std::unique_lock<std::mutex>> captor{2};
+
+  std::vector<Dispatch<int, int>> captured;
+  const CaptureRange<int> range{10, 10};
+
+  // Capture needs an element at or after the driving stamp, less the delay
+  const State state = capture_across_wake_threshold(
+    captor, range, captured, [&captor] { captor.inject(7, 7); }, [&captor] { captor.inject(8, 8); });
+
+  ASSERT_EQ(state, State::PRIMED);
+  ASSERT_EQ(captured.size(), 1UL);
+  EXPECT_EQ(captured.front().stamp, 7);
+}
+
+
+TEST(Captor, WaitingMatchedStampCaptureWakesAtRangeStart)
+{
+  follower::MatchedStamp<Dispatch<int, int>, std::unique_lock<std::mutex>> captor;
+
+  std::vector<Dispatch<int, int>> captured;
+  const CaptureRange<int> range{10, 10};
+
+  // Capture needs an element at or after the start of the capture range
+  const State state = capture_across_wake_threshold(
+    captor, range, captured, [&captor] { captor.inject(9, 9); }, [&captor] { captor.inject(10, 10); });
+
+  ASSERT_EQ(state, State::PRIMED);
+  ASSERT_EQ(captured.size(), 1UL);
+  EXPECT_EQ(captured.front().stamp, 10);
+}
+
+
+TEST(Captor, WaitingRangedCaptureOnEmptyQueueWakesAtRangeStart)
+{
+  const CaptureRange<int> range{10, 20};
+  std::vector<Dispatch<int, int>> captured;
+
+  // While the queue is empty, an element before the delayed range start does not change state
+  follower::Ranged<Dispatch<int, int>, std::unique_lock<std::mutex>> captor{1};
+  const State state = capture_across_wake_threshold(
+    captor, range, captured, [&captor] { captor.inject(8, 8); }, [&captor] { captor.inject(20, 20); });
+
+  ASSERT_EQ(state, State::PRIMED);
+  ASSERT_EQ(captured.size(), 2UL);
+
+  // While the queue is empty, an element at the delayed range start aborts capture
+  follower::Ranged<Dispatch<int, int>, std::unique_lock<std::mutex>> empty_captor{1};
+  const State empty_state =
+    capture_across_wake_threshold(empty_captor, range, captured, [] {}, [&empty_captor] { empty_captor.inject(9, 9); });
+
+  EXPECT_EQ(empty_state, State::ABORT);
+}
+
+
+TEST(Captor, WaitingRangedCaptureWakesAtDelayedRangeEnd)
+{
+  follower::Ranged<Dispatch<int, int>, std::unique_lock<std::mutex>> captor{1};
+  captor.inject(8, 8);
+
+  std::vector<Dispatch<int, int>> captured;
+  const CaptureRange<int> range{10, 20};
+
+  // Once the queue holds data before the range, capture needs an element after the delayed range end
+  const State state = capture_across_wake_threshold(
+    captor, range, captured, [&captor] { captor.inject(19, 19); }, [&captor] { captor.inject(20, 20); });
+
+  ASSERT_EQ(state, State::PRIMED);
+  ASSERT_EQ(captured.size(), 3UL);
+  EXPECT_EQ(captured.front().stamp, 8);
+  EXPECT_EQ(captured.back().stamp, 20);
+}
+
+
+template <typename LockPolicyT> void check_metadata_reads_during_injection()
+{
+  static constexpr int N = 1000;
+
+  driver::Next<Dispatch<int, int>, LockPolicyT> captor;
+  captor.set_capacity(10UL);
+
+  std::thread producer{[&captor] {
+    for (int t = 0; t < N; ++t)
+    {
+      captor.inject(t, t);
+    }
+  }};
+
+  // Metadata is read without locking, and must always describe a consistent queue state
+  std::size_t inconsistent = 0UL;
+  while (captor.get_available_stamp_range().upper_stamp < N - 1)
+  {
+    const auto range = captor.get_available_stamp_range();
+    if (range and (range.upper_stamp - range.lower_stamp) >= 10)
+    {
+      ++inconsistent;
+    }
+    if (captor.size() > 10UL)
+    {
+      ++inconsistent;
+    }
+  }
+  producer.join();
+
+  EXPECT_EQ(inconsistent, 0UL);
+  EXPECT_EQ(captor.size(), 10UL);
+  EXPECT_EQ(captor.get_available_stamp_range().lower_stamp, N - 10);
+}
+
+
+TEST(Captor, MetadataReadsDuringInjectionLockable)
+{
+  check_metadata_reads_during_injection<std::unique_lock<std::mutex>>();
+}
+
+
+TEST(Captor, MetadataReadsDuringInjectionPolling)
+{
+  check_metadata_reads_during_injection<PollingLock<std::lock_guard<std::mutex>>>();
+}
+
+
+TEST(Captor, MetadataReadsDuringInjectionAdaptiveMutex)
+{
+  check_metadata_reads_during_injection<std::unique_lock<AdaptiveMutex>>();
+}
+
+
+TEST(Captor, MetadataReadsDuringInjectionPollingAdaptiveMutex)
+{
+  check_metadata_reads_during_injection<PollingLock<std::lock_guard<AdaptiveMutex>>>();
+}
+
+
+/// Queue monitor which removes data before the capture range on every update
+struct PruningQueueMonitor : DefaultDispatchQueueMonitor
+{
+  template <typename DispatchT, typename DispatchContainerT, typename StampT>
+  static void update(DispatchQueue<DispatchT, DispatchContainerT>& queue, const CaptureRange<StampT>& range, const State)
+  {
+    queue.remove_before(range.lower_stamp);
+  }
+};
+
+
+template <typename LockPolicyT> void check_queue_monitor_update_publishes_metadata()
+{
+  follower::Before<Dispatch<int, int>, LockPolicyT, DefaultContainer<Dispatch<int, int>>, PruningQueueMonitor> captor{
+    0 /*delay*/};
+  for (int t = 0; t < 5; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  // Moves data out of any injection lane, and into the queue
+  captor.remove(-1);
+  ASSERT_EQ(captor.size(), 5UL);
+
+  captor.update_queue_monitor(CaptureRange<int>{3, 3}, State::PRIMED);
+  EXPECT_EQ(captor.size(), 2UL);
+  EXPECT_EQ(captor.get_available_stamp_range().lower_stamp, 3);
+  EXPECT_EQ(captor.get_available_stamp_range().upper_stamp, 4);
+}
+
+
+TEST(Captor, QueueMonitorUpdatePublishesMetadataLockable)
+{
+  check_queue_monitor_update_publishes_metadata<std::unique_lock<std::mutex>>();
+}
+
+
+TEST(Captor, QueueMonitorUpdatePublishesMetadataPolling)
+{
+  check_queue_monitor_update_publishes_metadata<PollingLock<std::lock_guard<std::mutex>>>();
+}
+
+
+TEST(Captor, QueueMonitorUpdatePublishesMetadataMPSCLane)
+{
+  check_queue_monitor_update_publishes_metadata<MPSCLane<8>>();
+}
+
+
+template <typename LockPolicyT> void check_inspect_does_not_block_inspect()
+{
+  driver::Next<Dispatch<int, int>, LockPolicyT> captor;
+  captor.inject(0, 0);
+
+  // Second inspection starts and finishes while the first is still running
+  std::atomic<bool> inner_done{false};
+  captor.inspect([&captor, &inner_done](const Dispatch<int, int>&) {
+    std::thread reader{[&captor, &inner_done] {
+      captor.inspect([](const Dispatch<int, int>&) {});
+      inner_done = true;
+    }};
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (!inner_done and std::chrono::steady_clock::now() < deadline)
+    {
+      std::this_thread::yield();
+    }
+    EXPECT_TRUE(inner_done);
+    reader.join();
+  });
+}
+
+
+TEST(Captor, InspectDoesNotBlockInspectSharedMutex)
+{
+  check_inspect_does_not_block_inspect<std::unique_lock<std::shared_timed_mutex>>();
+}
+
+
+TEST(Captor, InspectDoesNotBlockInspectPollingSharedMutex)
+{
+  check_inspect_does_not_block_inspect<PollingLock<std::lock_guard<std::shared_timed_mutex>>>();
+}
+
+
+TEST(Captor, MetadataReadsDuringInjectionSharedMutex)
+{
+  check_metadata_reads_during_injection<std::unique_lock<std::shared_timed_mutex>>();
+}
+
+
+/// Mutex which records whether it is held, to check what runs inside a captor critical section (single thread only)
+struct RecordingMutex
+{
+  static bool held;
+
+  void lock() { held = true; }
+
+  bool try_lock()
+  {
+    held = true;
+    return true;
+  }
+
+  void unlock() { held = false; }
+};
+
+bool RecordingMutex::held = false;
+
+
+/// Value which checks that it is never built while a captor mutex is held
+struct BuiltUnlocked
+{
+  explicit BuiltUnlocked(const int _value) : value{_value} { EXPECT_FALSE(RecordingMutex::held); }
+
+  int value;
+};
+
+
+template <typename LockPolicyT> void check_inject_builds_dispatch_before_locking()
+{
+  driver::Next<Dispatch<int, BuiltUnlocked>, LockPolicyT> captor;
+
+  captor.inject(1, 1);
+  captor.inject(0, 0);
+  EXPECT_FALSE(RecordingMutex::held);
+
+  ASSERT_EQ(captor.size(), 2UL);
+
+  // Data is still ordered by stamp
+  int expected = 0;
+  captor.inspect([&expected](const Dispatch<int, BuiltUnlocked>& dispatch) {
+    EXPECT_EQ(dispatch.stamp, expected);
+    EXPECT_EQ(dispatch.value.value, expected);
+    ++expected;
+  });
+}
+
+
+TEST(Captor, InjectBuildsDispatchBeforeLockingLockable)
+{
+  check_inject_builds_dispatch_before_locking<std::unique_lock<RecordingMutex>>();
+}
+
+
+TEST(Captor, InjectBuildsDispatchBeforeLockingPolling)
+{
+  check_inject_builds_dispatch_before_locking<PollingLock<std::lock_guard<RecordingMutex>>>();
+}
+
 #endif  // DOXYGEN_SKIP
@@ -0,0 +1,321 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/captor/nolock.hpp>
+#include <flow/container/recycling_list.hpp>
+#include <flow/container/splice_inserter.hpp>
+#include <flow/dispatch_queue.hpp>
+#include <flow/driver/chunk.hpp>
+#include <flow/driver/next.hpp>
+#include <flow/follower/any_before.hpp>
+
+using namespace flow;
+
+
+template <typename ListT> std::vector<int> to_vector(const ListT& list)
+{
+  return std::vector<int>{list.begin(), list.end()};
+}
+
+
+/// Allocator which counts allocations
+template <typename T> struct CountingAllocator
+{
+  using value_type = T;
+
+  explicit CountingAllocator(std::size_t* const _count) : count{_count} {}
+
+  template <typename U> CountingAllocator(const CountingAllocator<U>& other) : count{other.count} {}
+
+  T* allocate(const std::size_t n)
+  {
+    ++(*count);
+    return std::allocator<T>{}.allocate(n);
+  }
+
+  void deallocate(T* const ptr, const std::size_t n) { std::allocator<T>{}.deallocate(ptr, n); }
+
+  std::size_t* count;
+};
+
+
+TEST(RecyclingList, DefaultIsEmpty)
+{
+  RecyclingList<int> list;
+
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.size(), 0UL);
+  EXPECT_EQ(list.capacity(), 0UL);
+  EXPECT_TRUE(list.begin() == list.end());
+}
+
+
+TEST(RecyclingList, Emplace)
+{
+  RecyclingList<int> list;
+
+  list.emplace_back(2);
+  list.emplace_front(0);
+  list.emplace_back(4);
+  const auto itr = list.emplace(std::next(list.cbegin()), 1);
+  list.emplace(std::prev(list.cend()), 3);
+
+  EXPECT_EQ(*itr, 1);
+  EXPECT_EQ(to_vector(list), (std::vector<int>{0, 1, 2, 3, 4}));
+  EXPECT_EQ(list.front(), 0);
+  EXPECT_EQ(list.back(), 4);
+}
+
+
+TEST(RecyclingList, ReverseIteration)
+{
+  RecyclingList<int> list;
+
+  list.emplace_back(0);
+  list.emplace_back(1);
+  list.emplace_back(2);
+
+  EXPECT_EQ((std::vector<int>{list.rbegin(), list.rend()}), (std::vector<int>{2, 1, 0}));
+}
+
+
+TEST(RecyclingList, EraseKeepsNodes)
+{
+  RecyclingList<int> list;
+
+  for (int i = 0; i < 6; ++i)
+  {
+    list.emplace_back(i);
+  }
+
+  const auto itr = list.erase(std::next(list.cbegin()), std::next(list.cbegin(), 3));
+  EXPECT_EQ(*itr, 3);
+  list.pop_front();
+  list.pop_back();
+
+  EXPECT_EQ(to_vector(list), (std::vector<int>{3, 4}));
+  EXPECT_EQ(list.capacity(), 6UL);
+
+  list.clear();
+  EXPECT_TRUE(list.empty());
+  EXPECT_EQ(list.capacity(), 6UL);
+
+  list.shrink_to_fit();
+  EXPECT_EQ(list.capacity(), 0UL);
+}
+
+
+TEST(RecyclingList, NoAllocationAfterWarmup)
+{
+  std::size_t allocations = 0UL;
+  RecyclingList<int, CountingAllocator<int>> list{CountingAllocator<int>{&allocations}};
+
+  list.reserve(4);
+  ASSERT_EQ(allocations, 4UL);
+
+  for (int i = 0; i < 100; ++i)
+  {
+    if (list.size() == 4UL)
+    {
+      list.pop_front();
+    }
+    list.emplace_back(i);
+  }
+
+  EXPECT_EQ(allocations, 4UL);
+  EXPECT_EQ(to_vector(list), (std::vector<int>{96, 97, 98, 99}));
+}
+
+
+TEST(RecyclingList, SpliceRange)
+{
+  RecyclingList<int> source;
+  RecyclingList<int> destination;
+
+  for (int i = 0; i < 5; ++i)
+  {
+    source.emplace_back(i);
+  }
+  destination.emplace_back(-1);
+
+  const int* const moved = std::addressof(*std::next(source.begin()));
+  destination.splice(destination.cend(), source, std::next(source.cbegin()), std::next(source.cbegin(), 3));
+
+  EXPECT_EQ(to_vector(source), (std::vector<int>{0, 3, 4}));
+  EXPECT_EQ(to_vector(destination), (std::vector<int>{-1, 1, 2}));
+  EXPECT_EQ(source.size(), 3UL);
+  EXPECT_EQ(destination.size(), 3UL);
+
+  // Element was relinked, not moved
+  EXPECT_EQ(std::addressof(*std::next(destination.begin())), moved);
+}
+
+
+TEST(RecyclingList, SpliceAll)
+{
+  RecyclingList<int> source;
+  RecyclingList<int> destination;
+
+  source.emplace_back(1);
+  source.emplace_back(2);
+  destination.emplace_back(0);
+
+  destination.splice(destination.cend(), source);
+
+  EXPECT_TRUE(source.empty());
+  EXPECT_EQ(to_vector(destination), (std::vector<int>{0, 1, 2}));
+}
+
+
+TEST(RecyclingList, CopyAndMove)
+{
+  RecyclingList<int> list;
+  list.emplace_back(0);
+  list.emplace_back(1);
+
+  RecyclingList<int> copied{list};
+  EXPECT_EQ(to_vector(copied), (std::vector<int>{0, 1}));
+
+  RecyclingList<int> moved{std::move(list)};
+  EXPECT_EQ(to_vector(moved), (std::vector<int>{0, 1}));
+  EXPECT_TRUE(list.empty());
+
+  list = moved;
+  EXPECT_EQ(to_vector(list), (std::vector<int>{0, 1}));
+
+  RecyclingList<int> empty;
+  moved = std::move(empty);
+  EXPECT_TRUE(moved.empty());
+  moved.emplace_back(2);
+  EXPECT_EQ(to_vector(moved), (std::vector<int>{2}));
+}
+
+
+TEST(RecyclingList, DestroysElements)
+{
+  const auto counter = std::make_shared<int>(0);
+  {
+    RecyclingList<std::shared_ptr<int>> list;
+    list.emplace_back(counter);
+    list.emplace_back(counter);
+    list.emplace_back(counter);
+    list.pop_front();
+    ASSERT_EQ(counter.use_count(), 3L);
+  }
+  EXPECT_EQ(counter.use_count(), 1L);
+}
+
+
+TEST(RecyclingList, DispatchQueueInsertUnordered)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, RecyclingList<DispatchType>> queue;
+
+  for (int t : {0, 4, 2, 1, 3, 3})
+  {
+    queue.insert(t, t);
+  }
+
+  ASSERT_EQ(queue.size(), 5UL);
+
+  int expected_stamp = 0;
+  for (const auto& dispatch : queue)
+  {
+    EXPECT_EQ(dispatch.stamp, expected_stamp++);
+  }
+}
+
+
+TEST(RecyclingList, CaptorWithCapacity)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  driver::Next<DispatchType, NoLock, RecyclingList<DispatchType>> captor;
+  captor.set_capacity(3);
+
+  for (int t = 0; t < 10; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  ASSERT_EQ(captor.size(), 3UL);
+
+  std::vector<DispatchType> data;
+  CaptureRange<int> range;
+  ASSERT_EQ(State::PRIMED, captor.capture(std::back_inserter(data), range));
+  ASSERT_EQ(data.size(), 1UL);
+  EXPECT_EQ(data.front().stamp, 7);
+}
+
+
+TEST(RecyclingList, AnyBeforeSplicesCapturedData)
+{
+  using DispatchType = Dispatch<int, int>;
+  using ListType = RecyclingList<DispatchType>;
+
+  follower::AnyBefore<DispatchType, NoLock, ListType> captor{0};
+
+  for (int t = 0; t < 5; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  std::vector<const DispatchType*> queued;
+  captor.inspect([&queued](const DispatchType& dispatch) { queued.push_back(std::addressof(dispatch)); });
+
+  ListType data;
+  CaptureRange<int> range{3, 3};
+  ASSERT_EQ(State::PRIMED, captor.capture(splice_inserter(data), range));
+
+  ASSERT_EQ(data.size(), 3UL);
+  EXPECT_EQ(captor.size(), 2UL);
+
+  // Captured elements were relinked, not moved
+  auto itr = data.begin();
+  for (int t = 0; t < 3; ++t, ++itr)
+  {
+    EXPECT_EQ(itr->stamp, t);
+    EXPECT_EQ(std::addressof(*itr), queued[t]);
+  }
+}
+
+
+TEST(RecyclingList, ChunkSplicesCapturedData)
+{
+  using DispatchType = Dispatch<int, int>;
+  using ListType = RecyclingList<DispatchType>;
+
+  driver::Chunk<DispatchType, NoLock, ListType> captor{2};
+
+  for (int t = 0; t < 3; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  ListType data;
+  data.emplace_back(-1, -1);
+
+  CaptureRange<int> range;
+  ASSERT_EQ(State::PRIMED, captor.capture(splice_inserter(data), range));
+
+  ASSERT_EQ(data.size(), 3UL);
+  EXPECT_EQ(data.front().stamp, -1);
+  EXPECT_EQ(data.back().stamp, 1);
+  EXPECT_EQ(captor.size(), 1UL);
+}
+
+#endif  // DOXYGEN_SKIP
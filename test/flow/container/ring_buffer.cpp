@@ -0,0 +1,331 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <algorithm>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/captor/nolock.hpp>
+#include <flow/container/ring_buffer.hpp>
+#include <flow/dispatch_queue.hpp>
+#include <flow/driver/next.hpp>
+
+using namespace flow;
+
+
+template <typename BufferT> std::vector<int> to_vector(const BufferT& buffer)
+{
+  return std::vector<int>{buffer.begin(), buffer.end()};
+}
+
+
+TEST(RingBuffer, DefaultIsEmpty)
+{
+  RingBuffer<int, 4> buffer;
+
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(buffer.size(), 0UL);
+  EXPECT_EQ(buffer.capacity(), 4UL);
+  EXPECT_TRUE(buffer.begin() == buffer.end());
+}
+
+
+TEST(RingBuffer, EmplaceBackWrapsAround)
+{
+  RingBuffer<int, 4> buffer;
+
+  for (int i = 0; i < 16; ++i)
+  {
+    buffer.emplace_back(i);
+    if (buffer.size() > 3UL)
+    {
+      buffer.pop_front();
+    }
+  }
+
+  ASSERT_EQ(buffer.size(), 3UL);
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{13, 14, 15}));
+  EXPECT_EQ(buffer.front(), 13);
+  EXPECT_EQ(buffer.back(), 15);
+}
+
+
+TEST(RingBuffer, EmplaceFrontWrapsAround)
+{
+  RingBuffer<int, 4> buffer;
+
+  buffer.emplace_back(2);
+  buffer.emplace_front(1);
+  buffer.emplace_front(0);
+
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 1, 2}));
+}
+
+
+TEST(RingBuffer, ReverseIteration)
+{
+  RingBuffer<int, 4> buffer;
+
+  buffer.emplace_back(0);
+  buffer.emplace_back(1);
+  buffer.emplace_back(2);
+
+  EXPECT_EQ((std::vector<int>{buffer.rbegin(), buffer.rend()}), (std::vector<int>{2, 1, 0}));
+}
+
+
+TEST(RingBuffer, FixedCapacityThrowsWhenFull)
+{
+  RingBuffer<int, 2> buffer;
+
+  buffer.emplace_back(0);
+  buffer.emplace_back(1);
+
+  EXPECT_THROW(buffer.emplace_back(2), std::length_error);
+  EXPECT_THROW(buffer.emplace_front(2), std::length_error);
+  EXPECT_THROW(buffer.emplace(std::next(buffer.cbegin()), 2), std::length_error);
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 1}));
+}
+
+
+TEST(RingBuffer, DynamicCapacityGrowsWhenFull)
+{
+  RingBuffer<int> buffer{2};
+
+  ASSERT_EQ(buffer.capacity(), 2UL);
+
+  buffer.emplace_back(1);
+  buffer.emplace_back(2);
+  buffer.emplace_front(0);
+
+  EXPECT_GT(buffer.capacity(), 2UL);
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 1, 2}));
+}
+
+
+TEST(RingBuffer, EmplaceMiddleShiftFront)
+{
+  RingBuffer<int, 8> buffer;
+
+  for (int i : {0, 2, 3, 4, 5, 6})
+  {
+    buffer.emplace_back(i);
+  }
+
+  const auto itr = buffer.emplace(std::next(buffer.cbegin(), 1), 1);
+
+  EXPECT_EQ(*itr, 1);
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+}
+
+
+TEST(RingBuffer, EmplaceMiddleShiftBack)
+{
+  RingBuffer<int, 8> buffer;
+
+  for (int i : {0, 1, 2, 3, 4, 6})
+  {
+    buffer.emplace_back(i);
+  }
+
+  const auto itr = buffer.emplace(std::next(buffer.cbegin(), 5), 5);
+
+  EXPECT_EQ(*itr, 5);
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 1, 2, 3, 4, 5, 6}));
+}
+
+
+TEST(RingBuffer, EmplaceMiddleWrapped)
+{
+  RingBuffer<int, 6> buffer;
+
+  for (int i = 0; i < 4; ++i)
+  {
+    buffer.emplace_back(-1);
+    buffer.pop_front();
+  }
+
+  for (int i : {0, 1, 3, 4})
+  {
+    buffer.emplace_back(i);
+  }
+
+  buffer.emplace(std::next(buffer.cbegin(), 2), 2);
+
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+
+TEST(RingBuffer, ErasePrefix)
+{
+  RingBuffer<int, 8> buffer;
+
+  for (int i = 0; i < 6; ++i)
+  {
+    buffer.emplace_back(i);
+  }
+
+  buffer.erase(buffer.cbegin(), std::next(buffer.cbegin(), 4));
+
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{4, 5}));
+}
+
+
+TEST(RingBuffer, EraseSuffix)
+{
+  RingBuffer<int, 8> buffer;
+
+  for (int i = 0; i < 6; ++i)
+  {
+    buffer.emplace_back(i);
+  }
+
+  buffer.erase(std::next(buffer.cbegin(), 2), buffer.cend());
+
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 1}));
+}
+
+
+TEST(RingBuffer, EraseMiddle)
+{
+  RingBuffer<int, 8> buffer;
+
+  for (int i = 0; i < 8; ++i)
+  {
+    buffer.emplace_back(i);
+  }
+
+  buffer.erase(std::next(buffer.cbegin(), 1), std::next(buffer.cbegin(), 3));
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 3, 4, 5, 6, 7}));
+
+  buffer.erase(std::next(buffer.cbegin(), 3), std::next(buffer.cbegin(), 5));
+  EXPECT_EQ(to_vector(buffer), (std::vector<int>{0, 3, 4, 7}));
+}
+
+
+TEST(RingBuffer, CopyAndMove)
+{
+  RingBuffer<std::unique_ptr<int>, 4> buffer;
+  buffer.emplace_back(new int{1});
+  buffer.emplace_back(new int{2});
+
+  RingBuffer<std::unique_ptr<int>, 4> moved{std::move(buffer)};
+  ASSERT_EQ(moved.size(), 2UL);
+  EXPECT_EQ(*moved.front(), 1);
+  EXPECT_EQ(*moved.back(), 2);
+
+  RingBuffer<int> dynamic{8};
+  dynamic.emplace_back(1);
+
+  const RingBuffer<int> copied{dynamic};
+  EXPECT_EQ(copied.capacity(), 8UL);
+  EXPECT_EQ(to_vector(copied), (std::vector<int>{1}));
+}
+
+
+TEST(RingBuffer, DestroysElements)
+{
+  const auto counter = std::make_shared<int>(0);
+  {
+    RingBuffer<std::shared_ptr<int>, 4> buffer;
+    buffer.emplace_back(counter);
+    buffer.emplace_back(counter);
+    buffer.emplace_back(counter);
+    buffer.pop_front();
+    ASSERT_EQ(counter.use_count(), 3L);
+  }
+  EXPECT_EQ(counter.use_count(), 1L);
+}
+
+
+TEST(RingBuffer, DispatchQueueInsertUnordered)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, RingBuffer<DispatchType, 8>> queue;
+
+  for (int t : {0, 4, 2, 1, 3, 3})
+  {
+    queue.insert(t, t);
+  }
+
+  ASSERT_EQ(queue.size(), 5UL);
+
+  int expected_stamp = 0;
+  for (const auto& dispatch : queue)
+  {
+    EXPECT_EQ(dispatch.stamp, expected_stamp++);
+  }
+}
+
+
+TEST(RingBuffer, CaptorWithCapacity)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  driver::Next<DispatchType, NoLock, RingBuffer<DispatchType, 4>> captor;
+  captor.set_capacity(3);
+
+  for (int t = 0; t < 10; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  ASSERT_EQ(captor.size(), 3UL);
+
+  std::vector<DispatchType> data;
+  CaptureRange<int> range;
+  ASSERT_EQ(State::PRIMED, captor.capture(std::back_inserter(data), range));
+  ASSERT_EQ(data.size(), 1UL);
+  EXPECT_EQ(data.front().stamp, 7);
+}
+
+
+TEST(RingBuffer, CaptorInsertRangeWithCapacity)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  driver::Next<DispatchType, NoLock, RingBuffer<DispatchType, 4>> captor;
+  captor.set_capacity(3);
+
+  std::vector<DispatchType> dispatches;
+  for (int t = 9; t >= 0; --t)
+  {
+    dispatches.emplace_back(t, t);
+  }
+  captor.insert(dispatches.begin(), dispatches.end());
+
+  ASSERT_EQ(captor.size(), 3UL);
+  EXPECT_EQ(captor.get_available_stamp_range().lower_stamp, 7);
+  EXPECT_EQ(captor.get_available_stamp_range().upper_stamp, 9);
+}
+
+
+TEST(RingBuffer, CaptorInjectAtFullCapacity)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  driver::Next<DispatchType, NoLock, RingBuffer<DispatchType, 4>> captor;
+  captor.set_capacity(4);
+
+  for (int t : {0, 1, 2, 3, 5, 4, 7, 6, 3})
+  {
+    captor.inject(t, t);
+  }
+
+  ASSERT_EQ(captor.size(), 4UL);
+  EXPECT_EQ(captor.get_available_stamp_range().lower_stamp, 4);
+  EXPECT_EQ(captor.get_available_stamp_range().upper_stamp, 7);
+}
+
+#endif  // DOXYGEN_SKIP
@@ -0,0 +1,162 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <deque>
+#include <iterator>
+#include <list>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/captor/nolock.hpp>
+#include <flow/container/ring_buffer.hpp>
+#include <flow/container/stamp_indexed.hpp>
+#include <flow/dispatch_queue.hpp>
+#include <flow/follower/matched_stamp.hpp>
+
+using namespace flow;
+
+
+using DispatchType = Dispatch<int, int>;
+
+
+template <typename ContainerT> struct StampIndexedQueue : ::testing::Test
+{
+  DispatchQueue<DispatchType, ContainerT> queue;
+
+  std::vector<int> stamps() const
+  {
+    std::vector<int> s;
+    for (const auto& dispatch : queue)
+    {
+      s.push_back(dispatch.stamp);
+    }
+    return s;
+  }
+};
+
+using StampIndexedContainers = ::testing::Types<
+  StampIndexed<std::deque<DispatchType>>,
+  StampIndexed<std::list<DispatchType>>,
+  StampIndexed<RingBuffer<DispatchType>>>;
+
+TYPED_TEST_SUITE(StampIndexedQueue, StampIndexedContainers);
+
+
+TYPED_TEST(StampIndexedQueue, InsertUnordered)
+{
+  for (int t : {3, 0, 4, 2, 1, 3, 0, 5})
+  {
+    this->queue.insert(t, t);
+  }
+
+  EXPECT_EQ(this->stamps(), (std::vector<int>{0, 1, 2, 3, 4, 5}));
+  EXPECT_EQ(this->queue.oldest_stamp(), 0);
+  EXPECT_EQ(this->queue.newest_stamp(), 5);
+}
+
+
+TYPED_TEST(StampIndexedQueue, Bounds)
+{
+  for (int t : {1, 3, 5})
+  {
+    this->queue.insert(t, t);
+  }
+
+  EXPECT_EQ(this->queue.lower_bound(0), this->queue.begin());
+  EXPECT_EQ(this->queue.lower_bound(3)->stamp, 3);
+  EXPECT_EQ(this->queue.upper_bound(3)->stamp, 5);
+  EXPECT_EQ(this->queue.upper_bound(5), this->queue.end());
+  EXPECT_EQ(this->queue.lower_bound(std::next(this->queue.begin(), 2), 0)->stamp, 5);
+  EXPECT_EQ(this->queue.before(4)->stamp, 3);
+  EXPECT_EQ(this->queue.rbefore(4)->stamp, 3);
+}
+
+
+TYPED_TEST(StampIndexedQueue, RemoveKeepsIndexInLockstep)
+{
+  for (int t = 0; t < 10; ++t)
+  {
+    this->queue.insert(t, t);
+  }
+
+  this->queue.remove_before(2);
+  EXPECT_EQ(this->queue.lower_bound(0)->stamp, 2);
+
+  this->queue.remove_at_before(3);
+  EXPECT_EQ(this->queue.lower_bound(0)->stamp, 4);
+
+  this->queue.pop();
+  EXPECT_EQ(this->queue.lower_bound(0)->stamp, 5);
+
+  this->queue.remove_first_n(2);
+  EXPECT_EQ(this->queue.lower_bound(0)->stamp, 7);
+
+  this->queue.shrink_to_fit(1);
+  EXPECT_EQ(this->queue.lower_bound(0)->stamp, 9);
+  EXPECT_EQ(this->stamps(), (std::vector<int>{9}));
+
+  this->queue.clear();
+  EXPECT_EQ(this->queue.lower_bound(0), this->queue.end());
+
+  this->queue.insert(1, 1);
+  EXPECT_EQ(this->queue.lower_bound(0)->stamp, 1);
+}
+
+
+TYPED_TEST(StampIndexedQueue, MergeKeepsIndexInLockstep)
+{
+  for (int t : {1, 3, 5})
+  {
+    this->queue.insert(t, t);
+  }
+
+  const std::vector<DispatchType> dispatches{
+    DispatchType{0, 0}, DispatchType{2, 2}, DispatchType{3, 3}, DispatchType{4, 4}, DispatchType{6, 6}};
+  this->queue.merge(dispatches.begin(), dispatches.end(), 5UL);
+
+  EXPECT_EQ(this->stamps(), (std::vector<int>{2, 3, 4, 5, 6}));
+  EXPECT_EQ(this->queue.lower_bound(0)->stamp, 2);
+  EXPECT_EQ(this->queue.lower_bound(4)->stamp, 4);
+  EXPECT_EQ(this->queue.upper_bound(5)->stamp, 6);
+  EXPECT_EQ(this->queue.upper_bound(6), this->queue.end());
+}
+
+
+TEST(StampIndexed, ContainerConstructor)
+{
+  StampIndexed<std::deque<DispatchType>> container;
+  container.emplace_back(1, 1);
+  container.emplace_back(2, 2);
+
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> queue{container};
+
+  EXPECT_EQ(queue.lower_bound(2)->stamp, 2);
+  EXPECT_EQ(queue.upper_bound(2), queue.end());
+}
+
+
+TEST(StampIndexed, FollowerCapture)
+{
+  follower::MatchedStamp<DispatchType, NoLock, StampIndexed<std::deque<DispatchType>>> captor;
+
+  for (int t = 0; t < 10; ++t)
+  {
+    captor.inject(t, t);
+  }
+
+  std::vector<DispatchType> data;
+  CaptureRange<int> range{5, 5};
+  ASSERT_EQ(State::PRIMED, captor.capture(std::back_inserter(data), range));
+  ASSERT_EQ(data.size(), 1UL);
+  EXPECT_EQ(data.front().stamp, 5);
+  EXPECT_EQ(captor.size(), 5UL);
+}
+
+#endif  // DOXYGEN_SKIP
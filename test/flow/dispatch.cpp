@@ -6,12 +6,14 @@
 
 // C++ Standard Library
 #include <string>
+#include <vector>
 
 // GTest
 #include <gtest/gtest.h>
 
 // Flow
 #include <flow/dispatch.hpp>
+#include <flow/dispatch/shared.hpp>
 
 using namespace flow;
 
@@ -31,4 +33,48 @@ TEST(Dispatch, GetStamp)
   EXPECT_EQ(get_stamp(d), 3);
 }
 
+
+TEST(SharedDispatch, GetData)
+{
+  SharedDispatch<int, std::string> d{2, "test-value"};
+
+  EXPECT_EQ(get_value(d), "test-value");
+}
+
+
+TEST(SharedDispatch, DefaultHoldsValueInitializedValue)
+{
+  const SharedDispatch<int, std::string> d;
+  ASSERT_NE(d.value, nullptr);
+  EXPECT_EQ(get_stamp(d), 0);
+  EXPECT_TRUE(get_value(d).empty());
+}
+
+
+TEST(SharedDispatch, GetStamp)
+{
+  SharedDispatch<int, std::string> d{3, "test-value"};
+
+  EXPECT_EQ(get_stamp(d), 3);
+}
+
+
+TEST(SharedDispatch, CopySharesValue)
+{
+  const SharedDispatch<int, std::vector<int>> d{3, 1000UL, 7};
+  const auto d_copy = d;
+
+  EXPECT_EQ(d_copy.value.get(), d.value.get());
+  EXPECT_EQ(d.value->size(), 1000UL);
+}
+
+
+TEST(SharedDispatch, FromDispatch)
+{
+  SharedDispatch<int, std::string> d{Dispatch<int, std::string>{4, "test-value"}};
+
+  EXPECT_EQ(get_stamp(d), 4);
+  EXPECT_EQ(get_value(d), "test-value");
+}
+
 #endif  // DOXYGEN_SKIP
@@ -6,6 +6,12 @@
 
 // C++ Standard Library
 #include <deque>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
 
 // GTest
 #include <gtest/gtest.h>
@@ -180,6 +186,52 @@ TEST(DispatchQueue, RemoveAll)
 }
 
 
+TEST(DispatchQueue, RemoveBeforeLargeBacklog)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> random_access_queue;
+  DispatchQueue<DispatchType, std::list<DispatchType>> bidirectional_queue;
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> indexed_queue;
+
+  for (int stamp = 0; stamp < 10000; ++stamp)
+  {
+    random_access_queue.insert(stamp, stamp);
+    bidirectional_queue.insert(stamp, stamp);
+    indexed_queue.insert(stamp, stamp);
+  }
+
+  random_access_queue.remove_before(9000);
+  bidirectional_queue.remove_before(9000);
+  indexed_queue.remove_before(9000);
+
+  ASSERT_EQ(random_access_queue.size(), 1000UL);
+  ASSERT_EQ(bidirectional_queue.size(), 1000UL);
+  ASSERT_EQ(indexed_queue.size(), 1000UL);
+  EXPECT_EQ(random_access_queue.oldest_stamp(), 9000);
+  EXPECT_EQ(bidirectional_queue.oldest_stamp(), 9000);
+  EXPECT_EQ(indexed_queue.oldest_stamp(), 9000);
+
+  random_access_queue.remove_at_before(9000);
+  bidirectional_queue.remove_at_before(9000);
+  indexed_queue.remove_at_before(9000);
+
+  EXPECT_EQ(random_access_queue.oldest_stamp(), 9001);
+  EXPECT_EQ(bidirectional_queue.oldest_stamp(), 9001);
+  EXPECT_EQ(indexed_queue.oldest_stamp(), 9001);
+  EXPECT_EQ(indexed_queue.lower_bound(9500)->stamp, 9500);
+
+  random_access_queue.shrink_to_fit(10);
+  bidirectional_queue.shrink_to_fit(10);
+  indexed_queue.shrink_to_fit(10);
+
+  EXPECT_EQ(random_access_queue.oldest_stamp(), 9990);
+  EXPECT_EQ(bidirectional_queue.oldest_stamp(), 9990);
+  EXPECT_EQ(indexed_queue.oldest_stamp(), 9990);
+  EXPECT_EQ(indexed_queue.upper_bound(9994)->stamp, 9995);
+}
+
+
 TEST(DispatchQueue, InsertDuplicateTimeBehavior)
 {
   using DispatchType = Dispatch<int, int>;
@@ -307,4 +359,582 @@ TEST(DispatchQueue, ReverseBeforeItr)
   ASSERT_EQ(queue.rbefore(7)->stamp, 6);
 }
 
+
+TEST(DispatchQueue, LowerBoundItr)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> queue;
+
+  queue.insert(DispatchType{5, 8});
+  queue.insert(DispatchType{6, 9});
+  queue.insert(DispatchType{7, 10});
+
+  ASSERT_EQ(queue.lower_bound(4), queue.begin());
+  ASSERT_EQ(queue.lower_bound(6)->stamp, 6);
+  ASSERT_EQ(queue.lower_bound(8), queue.end());
+  ASSERT_EQ(queue.lower_bound(std::next(queue.begin(), 2), 6)->stamp, 7);
+}
+
+
+TEST(DispatchQueue, UpperBoundItr)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> queue;
+
+  queue.insert(DispatchType{5, 8});
+  queue.insert(DispatchType{6, 9});
+  queue.insert(DispatchType{7, 10});
+
+  ASSERT_EQ(queue.upper_bound(4), queue.begin());
+  ASSERT_EQ(queue.upper_bound(6)->stamp, 7);
+  ASSERT_EQ(queue.upper_bound(7), queue.end());
+  ASSERT_EQ(queue.upper_bound(queue.end(), 4), queue.end());
+}
+
+
+TEST(DispatchQueue, BoundItrNonRandomAccess)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::list<DispatchType>> queue;
+
+  queue.insert(DispatchType{5, 8});
+  queue.insert(DispatchType{6, 9});
+  queue.insert(DispatchType{7, 10});
+
+  ASSERT_EQ(queue.lower_bound(6)->stamp, 6);
+  ASSERT_EQ(queue.upper_bound(6)->stamp, 7);
+  ASSERT_EQ(queue.lower_bound(8), queue.end());
+  ASSERT_EQ(queue.upper_bound(4), queue.begin());
+}
+
+
+TEST(DispatchQueue, InsertOutOfOrderBursts)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> random_access_queue;
+  DispatchQueue<DispatchType, std::list<DispatchType>> bidirectional_queue;
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> indexed_queue;
+
+  // Insert bursts of 100 elements, each in reverse order
+  for (int burst = 0; burst < 5; ++burst)
+  {
+    for (int i = 99; i >= 0; --i)
+    {
+      const int stamp = burst * 100 + i;
+      random_access_queue.insert(stamp, stamp);
+      bidirectional_queue.insert(stamp, stamp);
+      indexed_queue.insert(stamp, stamp);
+
+      // Duplicate is not added
+      random_access_queue.insert(stamp, -1);
+      bidirectional_queue.insert(stamp, -1);
+      indexed_queue.insert(stamp, -1);
+    }
+  }
+
+  ASSERT_EQ(random_access_queue.size(), 500UL);
+  ASSERT_EQ(bidirectional_queue.size(), 500UL);
+  ASSERT_EQ(indexed_queue.size(), 500UL);
+
+  int expected_stamp = 0;
+  auto bidirectional_itr = bidirectional_queue.begin();
+  auto indexed_itr = indexed_queue.begin();
+  for (const auto& dispatch : random_access_queue)
+  {
+    EXPECT_EQ(dispatch.stamp, expected_stamp);
+    EXPECT_EQ(dispatch.value, expected_stamp);
+    EXPECT_EQ(bidirectional_itr->stamp, expected_stamp);
+    EXPECT_EQ(bidirectional_itr->value, expected_stamp);
+    EXPECT_EQ(indexed_itr->stamp, expected_stamp);
+    EXPECT_EQ(indexed_itr->value, expected_stamp);
+    ++expected_stamp;
+    ++bidirectional_itr;
+    ++indexed_itr;
+  }
+}
+
+
+template <typename QueueT> void check_insertion_stats(QueueT& queue)
+{
+  queue.insert(0, 0);
+  queue.insert(4, 0);
+  queue.insert(6, 0);
+  queue.insert(5, 0);
+  queue.insert(1, 0);
+
+  // Duplicates, and elements dropped to respect capacity, are not counted
+  queue.insert(1, 0);
+  queue.insert_and_limit(5UL, -1, 0);
+
+  const auto& stats = queue.get_insertion_stats();
+  EXPECT_EQ(stats.in_order, 3UL);
+  EXPECT_EQ(stats.out_of_order, 2UL);
+  EXPECT_EQ(stats.total_depth, 4UL);
+  EXPECT_EQ(stats.max_depth, 3UL);
+
+  queue.reset_insertion_stats();
+  EXPECT_EQ(queue.get_insertion_stats().in_order, 0UL);
+  EXPECT_EQ(queue.get_insertion_stats().out_of_order, 0UL);
+  EXPECT_EQ(queue.get_insertion_stats().total_depth, 0UL);
+  EXPECT_EQ(queue.get_insertion_stats().max_depth, 0UL);
+}
+
+
+TEST(DispatchQueue, InsertionStats)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> queue;
+  check_insertion_stats(queue);
+
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> indexed_queue;
+  check_insertion_stats(indexed_queue);
+}
+
+
+template <typename QueueT> std::vector<int> queue_stamps(const QueueT& queue)
+{
+  std::vector<int> stamps;
+  for (const auto& dispatch : queue)
+  {
+    stamps.push_back(dispatch.stamp);
+  }
+  return stamps;
+}
+
+
+template <typename QueueT> void check_insert_and_limit(QueueT& queue)
+{
+  for (int stamp : {0, 2, 4, 6})
+  {
+    EXPECT_EQ(queue.insert_and_limit(4, stamp, stamp), 0UL);
+  }
+
+  // Newer element replaces oldest element
+  EXPECT_EQ(queue.insert_and_limit(4, 5, 5), 1UL);
+  EXPECT_EQ(queue_stamps(queue), (std::vector<int>{2, 4, 5, 6}));
+
+  // Element which would be oldest is dropped
+  EXPECT_EQ(queue.insert_and_limit(4, 1, 1), 1UL);
+  EXPECT_EQ(queue_stamps(queue), (std::vector<int>{2, 4, 5, 6}));
+
+  // Duplicate element is not added, and nothing is dropped
+  EXPECT_EQ(queue.insert_and_limit(4, 4, -1), 0UL);
+  EXPECT_EQ(queue_stamps(queue), (std::vector<int>{2, 4, 5, 6}));
+
+  // Reduced capacity drops several elements
+  EXPECT_EQ(queue.insert_and_limit(2, 7, 7), 3UL);
+  EXPECT_EQ(queue_stamps(queue), (std::vector<int>{6, 7}));
+  EXPECT_EQ(queue.insert_and_limit(1, 3, 3), 2UL);
+  EXPECT_EQ(queue_stamps(queue), (std::vector<int>{7}));
+  EXPECT_EQ(queue.lower_bound(7)->stamp, 7);
+}
+
+
+TEST(DispatchQueue, InsertAndLimit)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> random_access_queue;
+  check_insert_and_limit(random_access_queue);
+
+  DispatchQueue<DispatchType, std::list<DispatchType>> bidirectional_queue;
+  check_insert_and_limit(bidirectional_queue);
+
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> indexed_queue;
+  check_insert_and_limit(indexed_queue);
+}
+
+
+TEST(DispatchQueue, MergeSorted)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> queue;
+
+  queue.insert(DispatchType{1, 0});
+  queue.insert(DispatchType{3, 0});
+  queue.insert(DispatchType{5, 0});
+
+  const std::vector<DispatchType> dispatches{
+    DispatchType{2, 1}, DispatchType{3, 1}, DispatchType{4, 1}, DispatchType{4, 2}, DispatchType{6, 1}};
+  queue.merge(dispatches.begin(), dispatches.end());
+
+  ASSERT_EQ(queue.size(), 6UL);
+
+  const std::vector<DispatchType> expected{DispatchType{1, 0},
+                                           DispatchType{2, 1},
+                                           DispatchType{3, 0},
+                                           DispatchType{4, 1},
+                                           DispatchType{5, 0},
+                                           DispatchType{6, 1}};
+  auto expected_itr = expected.begin();
+  for (const auto& dispatch : queue)
+  {
+    EXPECT_EQ(dispatch.stamp, expected_itr->stamp);
+    EXPECT_EQ(dispatch.value, expected_itr->value);
+    ++expected_itr;
+  }
+}
+
+
+TEST(DispatchQueue, MergeSortedWithCapacity)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> queue;
+
+  queue.insert(DispatchType{1, 0});
+  queue.insert(DispatchType{5, 0});
+  queue.insert(DispatchType{9, 0});
+
+  const std::vector<DispatchType> dispatches{DispatchType{0, 1}, DispatchType{6, 1}, DispatchType{7, 1}};
+  queue.merge(dispatches.begin(), dispatches.end(), 3UL);
+
+  ASSERT_EQ(queue.size(), 3UL);
+  EXPECT_EQ(queue.oldest_stamp(), 6);
+  EXPECT_EQ(queue.newest_stamp(), 9);
+}
+
+
+TEST(DispatchQueue, MergeCountsOnlyInsertionsWhichLand)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> queue;
+
+  queue.insert(DispatchType{1, 0});
+  queue.insert(DispatchType{5, 0});
+  queue.insert(DispatchType{9, 0});
+  queue.reset_insertion_stats();
+
+  // 0 would be dropped to respect capacity, and 5 duplicates a queued element
+  const std::vector<DispatchType> dispatches{DispatchType{0, 1}, DispatchType{5, 1}, DispatchType{6, 1}};
+  EXPECT_EQ(queue.merge(dispatches.begin(), dispatches.end(), 3UL), 2UL);
+
+  EXPECT_EQ(queue_stamps(queue), (std::vector<int>{5, 6, 9}));
+  EXPECT_EQ(queue.get_insertion_stats().in_order, 0UL);
+  EXPECT_EQ(queue.get_insertion_stats().out_of_order, 1UL);
+  EXPECT_EQ(queue.get_insertion_stats().total_depth, 1UL);
+}
+
+
+TEST(DispatchQueue, ExtractFirstN)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> queue;
+
+  for (int t = 0; t < 5; ++t)
+  {
+    queue.insert(t, t);
+  }
+
+  std::vector<DispatchType> extracted;
+  queue.extract_first_n(std::back_inserter(extracted), 3);
+
+  ASSERT_EQ(extracted.size(), 3UL);
+  EXPECT_EQ(extracted.front().stamp, 0);
+  EXPECT_EQ(extracted.back().stamp, 2);
+  ASSERT_EQ(queue.size(), 2UL);
+  EXPECT_EQ(queue.oldest_stamp(), 3);
+}
+
+
+TEST(DispatchQueue, ExtractFirstNSplice)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::list<DispatchType>> queue;
+
+  for (int t = 0; t < 5; ++t)
+  {
+    queue.insert(t, t);
+  }
+
+  const DispatchType* const first = std::addressof(*queue.begin());
+
+  std::list<DispatchType> extracted;
+  queue.extract_first_n(splice_inserter(extracted), 3);
+
+  ASSERT_EQ(extracted.size(), 3UL);
+  EXPECT_EQ(std::addressof(extracted.front()), first);
+  EXPECT_EQ(extracted.back().stamp, 2);
+  ASSERT_EQ(queue.size(), 2UL);
+  EXPECT_EQ(queue.oldest_stamp(), 3);
+}
+
+
+template <typename QueueT> void check_search_cursor(QueueT& queue)
+{
+  SearchCursor<int> lower_cursor;
+  SearchCursor<int> upper_cursor;
+
+  const auto check = [&queue, &lower_cursor, &upper_cursor](const int stamp) {
+    ASSERT_TRUE(queue.lower_bound(lower_cursor, stamp) == queue.lower_bound(stamp)) << "stamp=" << stamp;
+    ASSERT_TRUE(queue.upper_bound(upper_cursor, stamp) == queue.upper_bound(stamp)) << "stamp=" << stamp;
+  };
+
+  for (int stamp = 0; stamp < 100; stamp += 2)
+  {
+    queue.insert(stamp, stamp);
+  }
+
+  // Non-decreasing searches resume from previous result
+  for (int stamp = -1; stamp < 40; stamp += 3)
+  {
+    check(stamp);
+  }
+  check(39);
+
+  // Out-of-order insertions before and after the cursor, and removal from the front
+  queue.insert(31, 31);
+  queue.insert(45, 45);
+  check(41);
+  queue.remove_first_n(5);
+  check(47);
+  queue.remove_before(60);
+  check(55);
+  check(61);
+
+  // Searches for an earlier stamp restart from the oldest element
+  check(20);
+  check(70);
+
+  // Dropping elements past the cursor, and clearing, leave cursor usable
+  queue.shrink_to_fit(0);
+  check(71);
+  queue.insert(101, 101);
+  queue.insert(103, 103);
+  check(102);
+  queue.clear();
+  check(110);
+  queue.insert(111, 111);
+  check(111);
+  check(112);
+}
+
+
+TEST(DispatchQueue, SearchCursor)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> random_access_queue;
+  check_search_cursor(random_access_queue);
+
+  DispatchQueue<DispatchType, std::list<DispatchType>> bidirectional_queue;
+  check_search_cursor(bidirectional_queue);
+
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> indexed_queue;
+  check_search_cursor(indexed_queue);
+}
+
+
+TEST(DispatchQueue, GenerationChangesOnModification)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  DispatchQueue<DispatchType, std::deque<DispatchType>> queue;
+
+  auto generation = queue.generation();
+  const auto changed = [&queue, &generation] {
+    const bool result = queue.generation() != generation;
+    generation = queue.generation();
+    return result;
+  };
+
+  queue.insert(1, 1);
+  EXPECT_TRUE(changed());
+
+  // Out-of-order insertion
+  queue.insert(0, 0);
+  EXPECT_TRUE(changed());
+
+  // Lookups do not change the queue
+  queue.lower_bound(1);
+  queue.before(1);
+  EXPECT_FALSE(changed());
+
+  queue.remove_first_n(1UL);
+  EXPECT_TRUE(changed());
+
+  queue.pop();
+  EXPECT_TRUE(changed());
+
+  queue.clear();
+  EXPECT_TRUE(changed());
+}
+
+
+/// Value which throws when moved or copied while flagged
+struct ThrowOnTransfer
+{
+  bool fail = false;
+
+  ThrowOnTransfer() = default;
+
+  explicit ThrowOnTransfer(bool _fail) : fail{_fail} {}
+
+  ThrowOnTransfer(const ThrowOnTransfer& other) : fail{other.fail} { check(); }
+
+  ThrowOnTransfer(ThrowOnTransfer&& other) : fail{other.fail} { check(); }
+
+  ThrowOnTransfer& operator=(const ThrowOnTransfer& other) = default;
+
+  void check() const
+  {
+    if (fail)
+    {
+      throw std::runtime_error{"transfer failed"};
+    }
+  }
+};
+
+
+TEST(DispatchQueue, IndexedInsertThrowLeavesQueueUnchanged)
+{
+  using DispatchType = Dispatch<int, ThrowOnTransfer>;
+
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> queue;
+  for (int stamp : {2, 4, 6})
+  {
+    queue.insert(stamp, false);
+  }
+
+  const auto check_unchanged = [&queue] {
+    ASSERT_EQ(queue_stamps(queue), (std::vector<int>{2, 4, 6}));
+    EXPECT_EQ(queue.lower_bound(4)->stamp, 4);
+    EXPECT_EQ(queue.upper_bound(4)->stamp, 6);
+    EXPECT_EQ(queue.lower_bound(5)->stamp, 6);
+    EXPECT_EQ(queue.upper_bound(6), queue.end());
+  };
+
+  // Newest, oldest and intermediate placements
+  for (int stamp : {7, 1, 3})
+  {
+    EXPECT_THROW(queue.insert(DispatchType{stamp, true}), std::runtime_error);
+    check_unchanged();
+  }
+
+  EXPECT_THROW(queue.insert_and_limit(3UL, DispatchType{5, true}), std::runtime_error);
+  ASSERT_EQ(queue_stamps(queue), (std::vector<int>{4, 6}));
+  EXPECT_EQ(queue.lower_bound(5)->stamp, 6);
+
+  std::vector<DispatchType> dispatches;
+  dispatches.emplace_back(8, true);
+  EXPECT_THROW(queue.merge(dispatches.begin(), dispatches.end()), std::runtime_error);
+  ASSERT_EQ(queue_stamps(queue), (std::vector<int>{4, 6}));
+
+  // Index remains usable for later insertions
+  queue.insert(5, false);
+  EXPECT_EQ(queue.lower_bound(5)->stamp, 5);
+  EXPECT_EQ(queue.upper_bound(5)->stamp, 6);
+}
+
+TEST(DispatchQueue, MergeThrowKeepsQueuedElements)
+{
+  using DispatchType = Dispatch<int, ThrowOnTransfer>;
+
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> queue;
+  for (int stamp : {2, 4, 6})
+  {
+    queue.insert(stamp, false);
+  }
+
+  std::vector<DispatchType> dispatches;
+  dispatches.reserve(3UL);
+  dispatches.emplace_back(3, false);
+  dispatches.emplace_back(5, true);
+  dispatches.emplace_back(7, false);
+  EXPECT_THROW(queue.merge(dispatches.begin(), dispatches.end()), std::runtime_error);
+
+  // Elements merged before the failure stay, along with everything which was already queued
+  ASSERT_EQ(queue_stamps(queue), (std::vector<int>{2, 3, 4, 6}));
+  EXPECT_EQ(queue.lower_bound(5)->stamp, 6);
+  EXPECT_EQ(queue.upper_bound(3)->stamp, 4);
+}
+
+
+/// Stamp which throws on a chosen copy, after which copies succeed again
+struct FragileStamp
+{
+  /// Number of copies which succeed before the next one throws; negative to never throw
+  static int copies_before_failure;
+
+  int t = 0;
+
+  FragileStamp() = default;
+
+  FragileStamp(int _t) : t{_t} {}
+
+  FragileStamp(const FragileStamp& other) : t{other.t} { count_copy(); }
+
+  FragileStamp(FragileStamp&& other) noexcept = default;
+
+  FragileStamp& operator=(const FragileStamp& other)
+  {
+    count_copy();
+    t = other.t;
+    return *this;
+  }
+
+  FragileStamp& operator=(FragileStamp&& other) noexcept = default;
+
+  static void count_copy()
+  {
+    if (copies_before_failure >= 0 and copies_before_failure-- == 0)
+    {
+      throw std::runtime_error{"copy failed"};
+    }
+  }
+
+  bool operator<(const FragileStamp& other) const { return t < other.t; }
+
+  bool operator==(const FragileStamp& other) const { return t == other.t; }
+};
+
+int FragileStamp::copies_before_failure = -1;
+
+
+TEST(DispatchQueue, IndexedInsertStampCopyThrowLeavesQueueConsistent)
+{
+  using DispatchType = Dispatch<FragileStamp, int>;
+
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> queue;
+  for (int t : {2, 4, 6})
+  {
+    queue.insert(FragileStamp{t}, t);
+  }
+
+  // Fail each stamp copy made while inserting in turn, including the copy into the index
+  for (int copies = 0;; ++copies)
+  {
+    DispatchType dispatch{FragileStamp{5}, 5};
+    FragileStamp::copies_before_failure = copies;
+    try
+    {
+      queue.insert(std::move(dispatch));
+      FragileStamp::copies_before_failure = -1;
+      break;
+    }
+    catch (const std::runtime_error&)
+    {
+      FragileStamp::copies_before_failure = -1;
+    }
+
+    ASSERT_EQ(queue.size(), 3UL);
+    EXPECT_EQ(queue.lower_bound(FragileStamp{5})->value, 6);
+    EXPECT_EQ(queue.upper_bound(FragileStamp{4})->value, 6);
+    EXPECT_EQ(queue.upper_bound(FragileStamp{6}), queue.end());
+  }
+
+  ASSERT_EQ(queue.size(), 4UL);
+  EXPECT_EQ(queue.lower_bound(FragileStamp{5})->value, 5);
+  EXPECT_EQ(queue.upper_bound(FragileStamp{5})->value, 6);
+}
+
 #endif  // DOXYGEN_SKIP
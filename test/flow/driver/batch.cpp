@@ -14,6 +14,7 @@
 
 // Flow
 #include <flow/captor/nolock.hpp>
+#include <flow/dispatch/shared.hpp>
 #include <flow/driver/batch.hpp>
 #include <flow/utility/optional.hpp>
 
@@ -224,4 +225,32 @@ TEST_F(DriverBatch, RemovalOnAbort)
   ASSERT_EQ(this->size(), 1UL);
 }
 
+
+TEST(DriverBatchSharedDispatch, CaptureSharesQueuedValues)
+{
+  Batch<SharedDispatch<int, std::vector<int>>, NoLock> captor{2};
+
+  std::vector<const std::vector<int>*> injected;
+  for (int t = 0; t < 3; ++t)
+  {
+    captor.inject(t, 100UL, t);
+    captor.inspect([&injected, t](const SharedDispatch<int, std::vector<int>>& dispatch) {
+      if (dispatch.stamp == t)
+      {
+        injected.push_back(dispatch.value.get());
+      }
+    });
+  }
+
+  std::vector<SharedDispatch<int, std::vector<int>>> captured;
+  CaptureRange<int> range;
+  ASSERT_EQ(std::get<0>(captor.capture(std::back_inserter(captured), range)), State::PRIMED);
+  ASSERT_EQ(captured.size(), 2UL);
+  EXPECT_EQ(captured[0].value.get(), injected[0]);
+  EXPECT_EQ(captured[1].value.get(), injected[1]);
+
+  // Batch keeps all but the oldest element, which shares its value with the captured copy
+  EXPECT_EQ(captured[1].value.use_count(), 2L);
+}
+
 #endif  // DOXYGEN_SKIP
\ No newline at end of file
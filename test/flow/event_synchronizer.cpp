@@ -0,0 +1,290 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/captor/lockable.hpp>
+#include <flow/captor/polling.hpp>
+#include <flow/drivers.hpp>
+#include <flow/event_synchronizer.hpp>
+#include <flow/followers.hpp>
+
+using namespace flow;
+
+
+using DriverType = driver::Next<Dispatch<int, int>, std::unique_lock<std::mutex>>;
+using FollowerType = follower::Before<Dispatch<int, int>, std::unique_lock<std::mutex>>;
+using EventSynchronizerType = EventSynchronizer<DriverType, FollowerType>;
+
+
+TEST(EventSynchronizer, AttachesAndDetachesCaptors)
+{
+  DriverType driver;
+  FollowerType follower{0};
+  {
+    EventSynchronizerType sync{[](const EventSynchronizerType::result_type&, EventSynchronizerType::frame_type&&) {},
+                               driver,
+                               follower};
+    EXPECT_NE(driver.get_group_notifier(), nullptr);
+    EXPECT_NE(follower.get_group_notifier(), nullptr);
+    EXPECT_NE(driver.get_group_notifier(), follower.get_group_notifier());
+  }
+  EXPECT_EQ(driver.get_group_notifier(), nullptr);
+  EXPECT_EQ(follower.get_group_notifier(), nullptr);
+}
+
+
+TEST(EventSynchronizer, CallbackFromInject)
+{
+  DriverType driver;
+  FollowerType follower{0};
+
+  std::vector<EventSynchronizerType::frame_type> frames;
+  EventSynchronizerType sync{
+    [&frames](const EventSynchronizerType::result_type& result, EventSynchronizerType::frame_type&& frame) {
+      ASSERT_EQ(result.state, State::PRIMED);
+      frames.push_back(std::move(frame));
+    },
+    driver,
+    follower};
+
+  driver.inject(2, 2);
+  follower.inject(1, 1);
+  ASSERT_TRUE(frames.empty());
+
+  follower.inject(2, 2);
+  ASSERT_EQ(frames.size(), 1UL);
+  ASSERT_EQ(std::get<0>(frames.front()).size(), 1UL);
+  ASSERT_EQ(std::get<1>(frames.front()).size(), 1UL);
+  EXPECT_EQ(std::get<0>(frames.front()).front().stamp, 2);
+  EXPECT_EQ(std::get<1>(frames.front()).front().stamp, 1);
+  EXPECT_EQ(driver.size(), 0UL);
+}
+
+
+TEST(EventSynchronizer, CapturesFramesReadyOnConstruction)
+{
+  DriverType driver;
+  FollowerType follower{0};
+
+  driver.inject(2, 2);
+  follower.inject(2, 2);
+
+  std::size_t frame_count = 0;
+  EventSynchronizerType sync{
+    [&frame_count](const EventSynchronizerType::result_type&, EventSynchronizerType::frame_type&&) { ++frame_count; },
+    driver,
+    follower};
+
+  EXPECT_EQ(frame_count, 1UL);
+}
+
+
+TEST(EventSynchronizer, CapturesEveryReadyFrame)
+{
+  DriverType driver;
+  FollowerType follower{0};
+
+  std::vector<int> stamps;
+  EventSynchronizerType sync{
+    [&stamps](const EventSynchronizerType::result_type& result, EventSynchronizerType::frame_type&&) {
+      stamps.push_back(result.range.lower_stamp);
+    },
+    driver,
+    follower};
+
+  for (int t = 0; t < 5; ++t)
+  {
+    driver.inject(t, t);
+  }
+  ASSERT_TRUE(stamps.empty());
+
+  follower.inject(5, 5);
+  EXPECT_EQ(stamps, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+
+TEST(EventSynchronizer, OnlyBlockingCaptorTriggersCheck)
+{
+  DriverType driver;
+  FollowerType follower{0};
+
+  std::size_t frame_count = 0;
+  EventSynchronizerType sync{
+    [&frame_count](const EventSynchronizerType::result_type&, EventSynchronizerType::frame_type&&) { ++frame_count; },
+    driver,
+    follower};
+
+  // Driver has no data
+  ASSERT_EQ(sync.blocking_index(), 0UL);
+
+  // Follower has no data at or after the driving stamp
+  driver.inject(2, 2);
+  ASSERT_EQ(sync.blocking_index(), 1UL);
+
+  // New driver data does not change the frame which is waiting on the follower
+  driver.inject(3, 3);
+  ASSERT_EQ(sync.blocking_index(), 1UL);
+  ASSERT_EQ(frame_count, 0UL);
+
+  follower.inject(3, 3);
+  EXPECT_EQ(frame_count, 2UL);
+  EXPECT_EQ(sync.blocking_index(), 0UL);
+}
+
+
+TEST(EventSynchronizer, ExecutorRunsCallbacks)
+{
+  DriverType driver;
+  FollowerType follower{0};
+
+  std::vector<std::function<void()>> tasks;
+  std::vector<int> stamps;
+  EventSynchronizerType sync{
+    [&stamps](const EventSynchronizerType::result_type& result, EventSynchronizerType::frame_type&& frame) {
+      ASSERT_EQ(std::get<0>(frame).size(), 1UL);
+      stamps.push_back(std::get<0>(frame).front().stamp);
+    },
+    [&tasks](std::function<void()> task) { tasks.push_back(std::move(task)); },
+    driver,
+    follower};
+
+  driver.inject(1, 1);
+  driver.inject(2, 2);
+  follower.inject(2, 2);
+
+  ASSERT_EQ(tasks.size(), 2UL);
+  ASSERT_TRUE(stamps.empty());
+
+  for (auto& task : tasks)
+  {
+    task();
+  }
+  EXPECT_EQ(stamps, (std::vector<int>{1, 2}));
+}
+
+
+TEST(EventSynchronizer, CallbackMayInject)
+{
+  static constexpr int N = 5;
+
+  DriverType driver;
+  FollowerType follower{0};
+
+  std::vector<int> stamps;
+  EventSynchronizerType sync{
+    [&driver, &stamps](const EventSynchronizerType::result_type& result, EventSynchronizerType::frame_type&&) {
+      stamps.push_back(result.range.lower_stamp);
+      if (result.range.lower_stamp + 1 < N)
+      {
+        driver.inject(result.range.lower_stamp + 1, 0);
+      }
+    },
+    driver,
+    follower};
+
+  follower.inject(N, N);
+  driver.inject(0, 0);
+
+  EXPECT_EQ(stamps, (std::vector<int>{0, 1, 2, 3, 4}));
+}
+
+
+TEST(EventSynchronizer, AbortDropsFrames)
+{
+  DriverType driver;
+  FollowerType follower{0};
+
+  std::vector<int> stamps;
+  EventSynchronizerType sync{
+    [&stamps](const EventSynchronizerType::result_type& result, EventSynchronizerType::frame_type&&) {
+      stamps.push_back(result.range.lower_stamp);
+    },
+    driver,
+    follower};
+
+  driver.inject(1, 1);
+  driver.inject(2, 2);
+
+  // Removes driver data before the abort stamp, and drops the frame which is pending on abort
+  sync.abort(2);
+  EXPECT_EQ(driver.size(), 0UL);
+
+  driver.inject(3, 3);
+  follower.inject(4, 4);
+  EXPECT_EQ(stamps, (std::vector<int>{3}));
+}
+
+
+template <typename LockPolicyT> void event_capture_with_producers()
+{
+  static constexpr int N = 100;
+
+  using SyncDriverType = driver::Next<Dispatch<int, int>, LockPolicyT>;
+  using SyncFollowerType = follower::Before<Dispatch<int, int>, LockPolicyT>;
+  using SyncType = EventSynchronizer<SyncDriverType, SyncFollowerType>;
+
+  SyncDriverType driver;
+  SyncFollowerType follower{0};
+
+  std::mutex stamps_mutex;
+  std::vector<int> stamps;
+  SyncType sync{[&](const typename SyncType::result_type& result, typename SyncType::frame_type&&) {
+                  std::lock_guard<std::mutex> lock{stamps_mutex};
+                  stamps.push_back(result.range.lower_stamp);
+                },
+                driver,
+                follower};
+
+  std::thread driver_producer{[&driver] {
+    for (int t = 0; t < N; ++t)
+    {
+      driver.inject(t, t);
+    }
+  }};
+
+  std::thread follower_producer{[&follower] {
+    for (int t = 0; t <= N; ++t)
+    {
+      follower.inject(t, t);
+      std::this_thread::yield();
+    }
+  }};
+
+  driver_producer.join();
+  follower_producer.join();
+
+  // Every frame was captured by the producers themselves
+  std::vector<int> expected_stamps;
+  for (int t = 0; t < N; ++t)
+  {
+    expected_stamps.push_back(t);
+  }
+  EXPECT_EQ(stamps, expected_stamps);
+}
+
+
+TEST(EventSynchronizer, BlockingCaptorsWithProducerThreads)
+{
+  event_capture_with_producers<std::unique_lock<std::mutex>>();
+}
+
+
+TEST(EventSynchronizer, PollingCaptorsWithProducerThreads)
+{
+  event_capture_with_producers<PollingLock<std::lock_guard<std::mutex>>>();
+}
+
+#endif  // DOXYGEN_SKIP
@@ -262,4 +262,32 @@ TEST_F(FollowerBefore, RemovalOnAbort)
   ASSERT_EQ(this->size(), static_cast<std::size_t>(DELAY + 5));
 }
 
+
+TEST_F(FollowerBefore, CaptureIncludesLateDataAcrossFrames)
+{
+  for (int t = 0; t < 10; t += 2)
+  {
+    this->inject(Dispatch<int, optional<int>>{t, t});
+  }
+
+  // Each frame resumes its search from the previous boundary
+  CaptureRange<int> t_range{5, 5};
+  ASSERT_EQ(State::PRIMED, this->capture(std::back_inserter(data), t_range));
+  ASSERT_EQ(data.size(), 2U);
+
+  // Late data arrives before the previous boundary
+  this->inject(Dispatch<int, optional<int>>{3, 3});
+  this->inject(Dispatch<int, optional<int>>{5, 5});
+
+  data.clear();
+  t_range = CaptureRange<int>{8, 8};
+  ASSERT_EQ(State::PRIMED, this->capture(std::back_inserter(data), t_range));
+  ASSERT_EQ(data.size(), 4U);
+  EXPECT_EQ(data[0].stamp, 3);
+  EXPECT_EQ(data[1].stamp, 4);
+  EXPECT_EQ(data[2].stamp, 5);
+  EXPECT_EQ(data[3].stamp, 6);
+  EXPECT_EQ(this->size(), 1U);
+}
+
 #endif  // DOXYGEN_SKIP
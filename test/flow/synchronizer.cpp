@@ -5,9 +5,13 @@
 #ifndef DOXYGEN_SKIP
 
 // C++ Standard Library
+#include <array>
+#include <cstddef>
 #include <deque>
 #include <iterator>
 #include <list>
+#include <mutex>
+#include <thread>
 #include <tuple>
 #include <utility>
 #include <vector>
@@ -16,7 +20,10 @@
 #include <gtest/gtest.h>
 
 // Flow
+#include <flow/captor/lockable.hpp>
+#include <flow/captor/mpsc.hpp>
 #include <flow/captor/nolock.hpp>
+#include <flow/captor/polling.hpp>
 #include <flow/captor_state_ostream.hpp>
 #include <flow/drivers.hpp>
 #include <flow/followers.hpp>
@@ -198,4 +205,613 @@ TEST_F(SynchronizerTestSuiteST, CaptureErrorTimeGuard)
   ASSERT_TRUE(follower2_output_data.empty());
 }
 
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedCannotPrimeRetry)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{0, 2.0});
+
+  std::vector<Dispatch<int, int>> driver_output_data;
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(std::back_inserter(driver_output_data), NoCapture{}, NoCapture{}),
+    0);
+
+  ASSERT_FALSE(std::get<0>(result));
+  ASSERT_EQ(std::get<0>(result).state, State::RETRY);
+
+  // Nothing is extracted until synchronization is possible
+  ASSERT_TRUE(driver_output_data.empty());
+  ASSERT_EQ(driver->size(), 1UL);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedCanPrime)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{0, 2.0});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower2->inject(Dispatch<int, std::string>{20, "ok"});
+
+  std::vector<Dispatch<int, int>> driver_output_data;
+  std::vector<Dispatch<int, double>> follower1_output_data;
+  std::vector<Dispatch<int, std::string>> follower2_output_data;
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(
+      std::back_inserter(driver_output_data),
+      std::back_inserter(follower1_output_data),
+      std::back_inserter(follower2_output_data)),
+    0);
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(std::get<0>(result).state, State::PRIMED);
+
+  ASSERT_FALSE(driver_output_data.empty());
+  ASSERT_FALSE(follower1_output_data.empty());
+  ASSERT_TRUE(follower2_output_data.empty());
+  ASSERT_EQ(driver->size(), 0UL);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedDirectCaptureRange)
+{
+  follower1->inject(Dispatch<int, double>{0, 2.0});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower2->inject(Dispatch<int, std::string>{20, "ok"});
+
+  std::vector<Dispatch<int, double>> follower1_output_data;
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(CaptureRange<int>{10, 10}, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, std::back_inserter(follower1_output_data), NoCapture{}),
+    0);
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(std::get<0>(result).state, State::PRIMED);
+  ASSERT_FALSE(follower1_output_data.empty());
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedErrorTimeGuard)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower2->inject(Dispatch<int, std::string>{20, "ok"});
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}),
+    100 /*guard*/);
+
+  ASSERT_FALSE(std::get<0>(result));
+  ASSERT_EQ(std::get<0>(result).state, State::ERROR_DRIVER_LOWER_BOUND_EXCEEDED);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, LocateCannotPrimeRetry)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{0, 2.0});
+
+  const auto located = Synchronizer::locate(std::forward_as_tuple(*driver, *follower1, *follower2));
+
+  ASSERT_FALSE(located);
+  ASSERT_EQ(located.result.state, State::RETRY);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, LocateLeavesQueuesUnchanged)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{0, 2.0});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower2->inject(Dispatch<int, std::string>{5, "ok"});
+  follower2->inject(Dispatch<int, std::string>{20, "ok"});
+
+  const auto located = Synchronizer::locate(std::forward_as_tuple(*driver, *follower1, *follower2), 3);
+
+  ASSERT_TRUE(located);
+  ASSERT_EQ(located.result.range.lower_stamp, 10);
+  ASSERT_EQ(located.lower_bound, 3);
+  ASSERT_TRUE(located.ranges[0]);
+  ASSERT_TRUE(located.ranges[2]);
+
+  ASSERT_EQ(driver->size(), 1UL);
+  ASSERT_EQ(follower1->size(), 2UL);
+  ASSERT_EQ(follower2->size(), 2UL);
+
+  // Nothing changed, so locating again gives the same result
+  const auto relocated = Synchronizer::locate(std::forward_as_tuple(*driver, *follower1, *follower2), 3);
+  ASSERT_EQ(relocated.generations, located.generations);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedLocated)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{0, 2.0});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower2->inject(Dispatch<int, std::string>{5, "ok"});
+  follower2->inject(Dispatch<int, std::string>{20, "ok"});
+
+  const auto located = Synchronizer::locate(std::forward_as_tuple(*driver, *follower1, *follower2));
+  ASSERT_TRUE(located);
+
+  std::vector<Dispatch<int, int>> driver_output_data;
+  std::vector<Dispatch<int, double>> follower1_output_data;
+  std::vector<Dispatch<int, std::string>> follower2_output_data;
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(
+      std::back_inserter(driver_output_data),
+      std::back_inserter(follower1_output_data),
+      std::back_inserter(follower2_output_data)),
+    located);
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(std::get<0>(result).range.lower_stamp, 10);
+  ASSERT_EQ(driver_output_data.size(), 1UL);
+  ASSERT_EQ(follower1_output_data.size(), 1UL);
+  ASSERT_EQ(follower1_output_data.front().stamp, 9);
+  ASSERT_EQ(follower2_output_data.size(), 1UL);
+  ASSERT_EQ(follower2_output_data.front().stamp, 5);
+  ASSERT_EQ(driver->size(), 0UL);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedLocatedRelocatesAfterInjection)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+
+  const auto located = Synchronizer::locate(std::forward_as_tuple(*driver, *follower1, *follower2));
+  ASSERT_EQ(located.result.state, State::RETRY);
+
+  // Data which makes synchronization possible arrives after locate
+  follower2->inject(Dispatch<int, std::string>{20, "ok"});
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}),
+    located);
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(driver->size(), 0UL);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedLocatedRelocatesAfterOtherCapture)
+{
+  for (int t : {10, 20})
+  {
+    driver->inject(Dispatch<int, int>{t, t});
+    follower1->inject(Dispatch<int, double>{t - 1, 2.0});
+    follower2->inject(Dispatch<int, std::string>{t + 5, "ok"});
+  }
+
+  const auto located = Synchronizer::locate(std::forward_as_tuple(*driver, *follower1, *follower2));
+  ASSERT_EQ(located.result.range.lower_stamp, 10);
+
+  // Frame which was located is taken by another capture
+  Synchronizer::capture_locked(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}));
+
+  std::vector<Dispatch<int, int>> driver_output_data;
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(std::back_inserter(driver_output_data), NoCapture{}, NoCapture{}),
+    located);
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(std::get<0>(result).range.lower_stamp, 20);
+  ASSERT_EQ(driver_output_data.size(), 1UL);
+  ASSERT_EQ(driver_output_data.front().stamp, 20);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedLocatedRelocatesAfterLease)
+{
+  for (int t : {10, 20})
+  {
+    driver->inject(Dispatch<int, int>{t, t});
+    follower1->inject(Dispatch<int, double>{t - 1, 2.0});
+    follower2->inject(Dispatch<int, std::string>{t + 5, "ok"});
+  }
+
+  const auto located = Synchronizer::locate(std::forward_as_tuple(*driver, *follower1, *follower2));
+  ASSERT_EQ(located.result.range.lower_stamp, 10);
+
+  // Leasing the located driver data leaves it queued until the lease is released
+  CaptureRange<int> range;
+  const auto view = std::get<1>(driver->capture_view(range));
+  ASSERT_EQ(view.size(), 1UL);
+  ASSERT_EQ(driver->size(), 2UL);
+
+  std::vector<Dispatch<int, int>> driver_output_data;
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(std::back_inserter(driver_output_data), NoCapture{}, NoCapture{}),
+    located);
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(driver_output_data.size(), 1UL);
+  ASSERT_EQ(driver_output_data.front().stamp, 20);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureLockedLocatedRelocatesOnNewCaptureRange)
+{
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower1->inject(Dispatch<int, double>{19, 2.0});
+  follower2->inject(Dispatch<int, std::string>{30, "ok"});
+
+  const auto located =
+    Synchronizer::locate(std::forward_as_tuple(CaptureRange<int>{10, 10}, *follower1, *follower2));
+  ASSERT_TRUE(located);
+
+  std::vector<Dispatch<int, double>> follower1_output_data;
+
+  const auto result = Synchronizer::capture_locked(
+    std::forward_as_tuple(CaptureRange<int>{20, 20}, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, std::back_inserter(follower1_output_data), NoCapture{}),
+    located);
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(std::get<0>(result).range.lower_stamp, 20);
+  ASSERT_FALSE(follower1_output_data.empty());
+  ASSERT_EQ(follower1_output_data.back().stamp, 19);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, LocateSizesRetry)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+
+  const auto located = Synchronizer::locate(std::forward_as_tuple(*driver, *follower1, *follower2));
+
+  ASSERT_FALSE(located);
+  ASSERT_EQ(located.sizes, (std::array<std::size_t, 3UL>{0UL, 0UL, 0UL}));
+}
+
+
+TEST(Synchronizer, LocateSizesMatchCapturedData)
+{
+  using DispatchType = Dispatch<int, int>;
+
+  driver::Batch<DispatchType, NoLock> batch{3};
+  follower::Latched<DispatchType, NoLock> latched{0};
+  follower::Ranged<DispatchType, NoLock> ranged{0};
+  follower::CountBefore<DispatchType, NoLock> count_before{2, 0};
+  follower::AnyBefore<DispatchType, NoLock> any_before{0};
+  follower::ClosestBefore<DispatchType, NoLock> closest_before{10, 0};
+
+  for (int t = 10; t <= 100; t += 10)
+  {
+    batch.inject(t, t);
+  }
+  for (int t = 0; t <= 120; t += 5)
+  {
+    // Latched data stops early, so later frames re-use the latched element
+    if (t < 50)
+    {
+      latched.inject(t, t);
+    }
+    ranged.inject(t, t);
+    count_before.inject(t, t);
+    any_before.inject(t, t);
+    closest_before.inject(t, t);
+  }
+
+  const auto captors = [&] {
+    return std::forward_as_tuple(batch, latched, ranged, count_before, any_before, closest_before);
+  };
+
+  int n_frames = 0;
+  while (const auto located = Synchronizer::locate(captors()))
+  {
+    std::array<std::vector<DispatchType>, 6UL> outputs;
+    for (std::size_t i = 0; i < outputs.size(); ++i)
+    {
+      outputs[i].reserve(located.sizes[i]);
+    }
+
+    const auto result = Synchronizer::capture_locked(
+      captors(),
+      std::forward_as_tuple(
+        std::back_inserter(outputs[0]),
+        std::back_inserter(outputs[1]),
+        std::back_inserter(outputs[2]),
+        std::back_inserter(outputs[3]),
+        std::back_inserter(outputs[4]),
+        std::back_inserter(outputs[5])),
+      located);
+    ASSERT_TRUE(std::get<0>(result));
+
+    for (std::size_t i = 0; i < outputs.size(); ++i)
+    {
+      ASSERT_EQ(outputs[i].size(), located.sizes[i]) << "frame=" << n_frames << " captor=" << i;
+      ASSERT_EQ(outputs[i].capacity(), located.sizes[i]) << "frame=" << n_frames << " captor=" << i;
+    }
+    ++n_frames;
+  }
+
+  ASSERT_EQ(n_frames, 8);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureAllNoFramesRetry)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{0, 2.0});
+
+  std::vector<Dispatch<int, int>> driver_output_data;
+  int n_frames = 0;
+
+  const auto result = Synchronizer::capture_all(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(std::back_inserter(driver_output_data), NoCapture{}, NoCapture{}),
+    [&n_frames](const Result<int>&) { ++n_frames; });
+
+  ASSERT_EQ(std::get<0>(result).state, State::RETRY);
+  ASSERT_EQ(n_frames, 0);
+
+  // Nothing is extracted until synchronization is possible
+  ASSERT_TRUE(driver_output_data.empty());
+  ASSERT_EQ(driver->size(), 1UL);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureAllEveryReadyFrame)
+{
+  for (int t : {10, 20, 30})
+  {
+    driver->inject(Dispatch<int, int>{t, t});
+    follower1->inject(Dispatch<int, double>{t - 1, 2.0});
+  }
+  for (int t : {5, 15, 25, 35})
+  {
+    follower2->inject(Dispatch<int, std::string>{t, "ok"});
+  }
+
+  std::vector<Dispatch<int, int>> driver_output_data;
+  std::vector<Dispatch<int, double>> follower1_output_data;
+  std::vector<Dispatch<int, std::string>> follower2_output_data;
+  std::vector<int> frame_stamps;
+
+  const auto result = Synchronizer::capture_all(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(
+      std::back_inserter(driver_output_data),
+      std::back_inserter(follower1_output_data),
+      std::back_inserter(follower2_output_data)),
+    [&](const Result<int>& frame) {
+      // Data from this frame is already written, and may be moved out
+      ASSERT_TRUE(frame);
+      ASSERT_EQ(driver_output_data.size(), 1UL);
+      ASSERT_EQ(follower1_output_data.size(), 1UL);
+      ASSERT_EQ(driver_output_data.front().stamp, frame.range.lower_stamp);
+      ASSERT_EQ(follower1_output_data.front().stamp, frame.range.lower_stamp - 1);
+      frame_stamps.push_back(frame.range.lower_stamp);
+      driver_output_data.clear();
+      follower1_output_data.clear();
+      follower2_output_data.clear();
+    });
+
+  // Batch ends when no more frames are ready, and reports the last captured frame
+  ASSERT_EQ(std::get<0>(result).state, State::PRIMED);
+  ASSERT_EQ(std::get<0>(result).range.lower_stamp, 30);
+  ASSERT_EQ(frame_stamps, (std::vector<int>{10, 20, 30}));
+  ASSERT_EQ(driver->size(), 0UL);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureAllLeavesFailedFrameForNextCall)
+{
+  for (int t : {10, 20, 30})
+  {
+    driver->inject(Dispatch<int, int>{t, t});
+    follower2->inject(Dispatch<int, std::string>{t - 5, "ok"});
+  }
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower1->inject(Dispatch<int, double>{19, 2.0});
+
+  // No data just before the third driving stamp, which will be aborted
+  follower1->inject(Dispatch<int, double>{31, 2.0});
+
+  std::vector<int> frame_stamps;
+  const auto record_frame = [&frame_stamps](const Result<int>& frame) {
+    frame_stamps.push_back(frame.range.lower_stamp);
+  };
+
+  const auto result = Synchronizer::capture_all(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}),
+    record_frame);
+
+  ASSERT_EQ(std::get<0>(result).state, State::PRIMED);
+  ASSERT_EQ(std::get<0>(result).range.lower_stamp, 20);
+  ASSERT_EQ(frame_stamps, (std::vector<int>{10, 20}));
+  ASSERT_EQ(driver->size(), 1UL);
+
+  const auto next_result = Synchronizer::capture_all(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}),
+    record_frame);
+
+  ASSERT_EQ(std::get<0>(next_result).state, State::ABORT);
+  ASSERT_EQ(frame_stamps.size(), 2UL);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureNStopsAtMaxFrames)
+{
+  for (int t : {10, 20, 30})
+  {
+    driver->inject(Dispatch<int, int>{t, t});
+    follower1->inject(Dispatch<int, double>{t - 1, 2.0});
+    follower2->inject(Dispatch<int, std::string>{t + 5, "ok"});
+  }
+
+  std::vector<Dispatch<int, int>> driver_output_data;
+  int n_frames = 0;
+
+  const auto result = Synchronizer::capture_n(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(std::back_inserter(driver_output_data), NoCapture{}, NoCapture{}),
+    [&n_frames](const Result<int>&) { ++n_frames; },
+    2);
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(std::get<0>(result).range.lower_stamp, 20);
+  ASSERT_EQ(n_frames, 2);
+  ASSERT_EQ(driver_output_data.size(), 2UL);
+  ASSERT_EQ(driver->size(), 1UL);
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureAllDirectCaptureRangeSingleFrame)
+{
+  follower1->inject(Dispatch<int, double>{0, 2.0});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower2->inject(Dispatch<int, std::string>{20, "ok"});
+
+  std::vector<Dispatch<int, double>> follower1_output_data;
+  int n_frames = 0;
+
+  const auto result = Synchronizer::capture_all(
+    std::forward_as_tuple(CaptureRange<int>{10, 10}, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, std::back_inserter(follower1_output_data), NoCapture{}),
+    [&n_frames](const Result<int>&) { ++n_frames; });
+
+  ASSERT_TRUE(std::get<0>(result));
+  ASSERT_EQ(n_frames, 1);
+  ASSERT_FALSE(follower1_output_data.empty());
+}
+
+
+TEST_F(SynchronizerTestSuiteST, CaptureAllErrorTimeGuard)
+{
+  driver->inject(Dispatch<int, int>{10, 10});
+  follower1->inject(Dispatch<int, double>{9, 2.0});
+  follower2->inject(Dispatch<int, std::string>{20, "ok"});
+
+  int n_frames = 0;
+
+  const auto result = Synchronizer::capture_all(
+    std::forward_as_tuple(*driver, *follower1, *follower2),
+    std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}),
+    [&n_frames](const Result<int>&) { ++n_frames; },
+    100 /*guard*/);
+
+  ASSERT_EQ(std::get<0>(result).state, State::ERROR_DRIVER_LOWER_BOUND_EXCEEDED);
+  ASSERT_EQ(n_frames, 0);
+}
+
+
+template <typename LockPolicyT> void capture_locked_overlapping_captor_orders()
+{
+  static constexpr int N = 200;
+
+  follower::Before<Dispatch<int, int>, LockPolicyT> follower1{0};
+  follower::Before<Dispatch<int, int>, LockPolicyT> follower2{0};
+
+  // Followers are locked in opposite orders by each capture thread
+  const auto capture_frames = [](auto& first, auto& second) {
+    for (int t = 0; t < N; ++t)
+    {
+      Synchronizer::capture_locked(
+        std::forward_as_tuple(CaptureRange<int>{t, t}, first, second),
+        std::forward_as_tuple(NoCapture{}, NoCapture{}, NoCapture{}));
+    }
+  };
+
+  std::thread producer{[&follower1, &follower2] {
+    for (int t = 0; t < N; ++t)
+    {
+      follower1.inject(t, t);
+      follower2.inject(t, t);
+    }
+  }};
+  std::thread forward_capture{[&] { capture_frames(follower1, follower2); }};
+  std::thread reverse_capture{[&] { capture_frames(follower2, follower1); }};
+
+  producer.join();
+  forward_capture.join();
+  reverse_capture.join();
+
+  SUCCEED();
+}
+
+
+TEST(Synchronizer, CaptureLockedBlockingCaptorsOverlappingOrders)
+{
+  capture_locked_overlapping_captor_orders<std::unique_lock<std::mutex>>();
+}
+
+
+TEST(Synchronizer, CaptureLockedPollingCaptorsOverlappingOrders)
+{
+  capture_locked_overlapping_captor_orders<PollingLock<std::lock_guard<std::mutex>>>();
+}
+
+
+TEST(Synchronizer, CaptureLockedLaneCaptorsOverlappingOrders)
+{
+  capture_locked_overlapping_captor_orders<MPSCLane<64UL>>();
+}
+
+template <typename LockPolicyT> void capture_all_concurrent_producer()
+{
+  static constexpr int N = 200;
+
+  driver::Next<Dispatch<int, int>, LockPolicyT> driver;
+  follower::Before<Dispatch<int, int>, LockPolicyT> follower{0};
+
+  std::thread producer{[&driver, &follower] {
+    for (int t = 0; t < N; ++t)
+    {
+      follower.inject(t, t);
+      driver.inject(t, t);
+    }
+    follower.inject(N, N);
+  }};
+
+  // Every frame is captured exactly once, in order, across batches
+  std::vector<int> frame_stamps;
+  while (frame_stamps.size() < static_cast<std::size_t>(N))
+  {
+    Synchronizer::capture_all(
+      std::forward_as_tuple(driver, follower),
+      std::forward_as_tuple(NoCapture{}, NoCapture{}),
+      [&frame_stamps](const Result<int>& frame) { frame_stamps.push_back(frame.range.lower_stamp); });
+  }
+
+  producer.join();
+
+  for (int t = 0; t < N; ++t)
+  {
+    ASSERT_EQ(frame_stamps[t], t);
+  }
+}
+
+
+TEST(Synchronizer, CaptureAllBlockingCaptorsConcurrentProducer)
+{
+  capture_all_concurrent_producer<std::unique_lock<std::mutex>>();
+}
+
+
+TEST(Synchronizer, CaptureAllPollingCaptorsConcurrentProducer)
+{
+  capture_all_concurrent_producer<PollingLock<std::lock_guard<std::mutex>>>();
+}
+
 #endif  // DOXYGEN_SKIP
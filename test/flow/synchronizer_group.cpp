@@ -0,0 +1,151 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <chrono>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <tuple>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/captor/lockable.hpp>
+#include <flow/captor/polling.hpp>
+#include <flow/drivers.hpp>
+#include <flow/followers.hpp>
+#include <flow/synchronizer_group.hpp>
+#include <flow/utility/adaptive_mutex.hpp>
+
+using namespace flow;
+
+
+TEST(SynchronizerGroup, AttachesAndDetachesCaptors)
+{
+  driver::Next<Dispatch<int, int>, std::unique_lock<std::mutex>> driver;
+  follower::Before<Dispatch<int, int>, std::unique_lock<std::mutex>> follower{0};
+  {
+    SynchronizerGroup<decltype(driver), decltype(follower)> group{driver, follower};
+    EXPECT_EQ(driver.get_group_notifier(), &group.get_notifier());
+    EXPECT_EQ(follower.get_group_notifier(), &group.get_notifier());
+  }
+  EXPECT_EQ(driver.get_group_notifier(), nullptr);
+  EXPECT_EQ(follower.get_group_notifier(), nullptr);
+}
+
+
+TEST(SynchronizerGroup, CaptureWithoutWaiting)
+{
+  driver::Next<Dispatch<int, int>, std::unique_lock<std::mutex>> driver;
+  follower::Before<Dispatch<int, int>, std::unique_lock<std::mutex>> follower{0};
+  SynchronizerGroup<decltype(driver), decltype(follower)> group{driver, follower};
+
+  driver.inject(2, 2);
+  follower.inject(1, 1);
+  follower.inject(2, 2);
+
+  std::vector<Dispatch<int, int>> driver_data;
+  std::vector<Dispatch<int, int>> follower_data;
+  const auto result =
+    group.capture(std::forward_as_tuple(std::back_inserter(driver_data), std::back_inserter(follower_data)));
+
+  ASSERT_EQ(std::get<0>(result).state, State::PRIMED);
+  ASSERT_EQ(driver_data.size(), 1UL);
+  ASSERT_EQ(follower_data.size(), 1UL);
+  EXPECT_EQ(follower_data.front().stamp, 1);
+}
+
+
+TEST(SynchronizerGroup, CaptureTimeoutLeavesData)
+{
+  driver::Next<Dispatch<int, int>, std::unique_lock<std::mutex>> driver;
+  follower::Before<Dispatch<int, int>, std::unique_lock<std::mutex>> follower{0};
+  SynchronizerGroup<decltype(driver), decltype(follower)> group{driver, follower};
+
+  // Follower has no data at or after the driving stamp, so synchronization is not possible
+  driver.inject(2, 2);
+  follower.inject(1, 1);
+
+  std::vector<Dispatch<int, int>> driver_data;
+  std::vector<Dispatch<int, int>> follower_data;
+  const auto result = group.capture(
+    std::forward_as_tuple(std::back_inserter(driver_data), std::back_inserter(follower_data)),
+    StampTraits<int>::min(),
+    std::chrono::steady_clock::now() + std::chrono::milliseconds{10});
+
+  EXPECT_EQ(std::get<0>(result).state, State::TIMEOUT);
+  EXPECT_TRUE(driver_data.empty());
+  EXPECT_TRUE(follower_data.empty());
+  EXPECT_EQ(driver.size(), 1UL);
+  EXPECT_EQ(follower.size(), 1UL);
+}
+
+
+template <typename LockPolicyT> void group_capture_with_producers()
+{
+  static constexpr int N = 100;
+
+  driver::Next<Dispatch<int, int>, LockPolicyT> driver;
+  follower::Before<Dispatch<int, int>, LockPolicyT> follower{0};
+  SynchronizerGroup<decltype(driver), decltype(follower)> group{driver, follower};
+
+  std::thread driver_producer{[&driver] {
+    for (int t = 0; t < N; ++t)
+    {
+      driver.inject(t, t);
+    }
+  }};
+
+  std::thread follower_producer{[&follower] {
+    for (int t = 0; t <= N; ++t)
+    {
+      follower.inject(t, t);
+      std::this_thread::yield();
+    }
+  }};
+
+  int captured = 0;
+  for (int t = 0; t < N; ++t)
+  {
+    std::vector<Dispatch<int, int>> driver_data;
+    const auto result = group.capture(
+      std::forward_as_tuple(std::back_inserter(driver_data), NoCapture{}),
+      StampTraits<int>::min(),
+      std::chrono::steady_clock::now() + std::chrono::seconds{5});
+    ASSERT_EQ(std::get<0>(result).state, State::PRIMED);
+    ASSERT_EQ(driver_data.size(), 1UL);
+    EXPECT_EQ(driver_data.front().stamp, t);
+    ++captured;
+  }
+
+  driver_producer.join();
+  follower_producer.join();
+
+  EXPECT_EQ(captured, N);
+}
+
+
+TEST(SynchronizerGroup, BlockingCaptorsWithProducerThreads)
+{
+  group_capture_with_producers<std::unique_lock<std::mutex>>();
+}
+
+
+TEST(SynchronizerGroup, PollingCaptorsWithProducerThreads)
+{
+  group_capture_with_producers<PollingLock<std::lock_guard<std::mutex>>>();
+}
+
+
+TEST(SynchronizerGroup, AdaptiveMutexCaptorsWithProducerThreads)
+{
+  group_capture_with_producers<std::unique_lock<AdaptiveMutex>>();
+}
+
+#endif  // DOXYGEN_SKIP
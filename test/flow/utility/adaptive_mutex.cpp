@@ -0,0 +1,63 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/utility/adaptive_mutex.hpp>
+
+using namespace flow;
+
+
+TEST(AdaptiveMutex, TryLockFailsWhileHeld)
+{
+  AdaptiveMutex mutex;
+
+  ASSERT_TRUE(mutex.try_lock());
+  std::thread other{[&mutex] { EXPECT_FALSE(mutex.try_lock()); }};
+  other.join();
+  mutex.unlock();
+
+  EXPECT_TRUE(mutex.try_lock());
+  mutex.unlock();
+}
+
+
+TEST(AdaptiveMutex, MutualExclusion)
+{
+  static constexpr int N_THREADS = 4;
+  static constexpr int N_INCREMENTS = 10000;
+
+  AdaptiveMutex mutex;
+  int count = 0;
+
+  std::vector<std::thread> threads;
+  for (int t = 0; t < N_THREADS; ++t)
+  {
+    threads.emplace_back([&mutex, &count] {
+      for (int i = 0; i < N_INCREMENTS; ++i)
+      {
+        std::lock_guard<AdaptiveMutex> lock{mutex};
+        ++count;
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(count, N_THREADS * N_INCREMENTS);
+}
+
+#endif  // DOXYGEN_SKIP
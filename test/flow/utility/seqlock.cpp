@@ -0,0 +1,98 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/utility/seqlock.hpp>
+
+using namespace flow;
+
+
+/// Value whose fields are only consistent if written together
+struct Triple
+{
+  std::int64_t a = 0;
+  std::int64_t b = 1;
+  std::int64_t c = 2;
+};
+
+
+TEST(SeqLock, DefaultLoadsDefaultValue)
+{
+  SeqLock<Triple> seqlock;
+
+  const auto value = seqlock.load();
+  EXPECT_EQ(value.a, 0);
+  EXPECT_EQ(value.b, 1);
+  EXPECT_EQ(value.c, 2);
+}
+
+
+TEST(SeqLock, LoadsLastStoredValue)
+{
+  SeqLock<Triple> seqlock;
+
+  seqlock.store(Triple{5, 6, 7});
+  seqlock.store(Triple{8, 9, 10});
+
+  const auto value = seqlock.load();
+  EXPECT_EQ(value.a, 8);
+  EXPECT_EQ(value.b, 9);
+  EXPECT_EQ(value.c, 10);
+}
+
+
+TEST(SeqLock, CopyLoadsSameValue)
+{
+  SeqLock<Triple> seqlock{Triple{5, 6, 7}};
+  SeqLock<Triple> copied{seqlock};
+
+  EXPECT_EQ(copied.load().a, 5);
+  EXPECT_EQ(copied.load().c, 7);
+}
+
+
+TEST(SeqLock, ReadersNeverSeePartialWrites)
+{
+  static constexpr std::int64_t N = 100000;
+
+  SeqLock<Triple> seqlock;
+  std::atomic<bool> writing{true};
+
+  std::thread writer{[&seqlock, &writing] {
+    for (std::int64_t i = 1; i <= N; ++i)
+    {
+      seqlock.store(Triple{i, i + 1, i + 2});
+    }
+    writing = false;
+  }};
+
+  std::size_t inconsistent = 0UL;
+  std::int64_t previous = 0;
+  while (writing)
+  {
+    const auto value = seqlock.load();
+    if (value.b != value.a + 1 or value.c != value.a + 2 or value.a < previous)
+    {
+      ++inconsistent;
+    }
+    previous = value.a;
+  }
+
+  writer.join();
+  EXPECT_EQ(inconsistent, 0UL);
+  EXPECT_EQ(seqlock.load().a, N);
+}
+
+#endif  // DOXYGEN_SKIP
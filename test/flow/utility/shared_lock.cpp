@@ -0,0 +1,37 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <mutex>
+#include <shared_mutex>
+#include <type_traits>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/utility/adaptive_mutex.hpp>
+#include <flow/utility/shared_lock.hpp>
+
+using namespace flow;
+
+
+TEST(ReadLock, SharedForSharedMutex)
+{
+  EXPECT_TRUE((std::is_same<
+               ReadLock<std::shared_timed_mutex, std::unique_lock<std::shared_timed_mutex>>,
+               std::shared_lock<std::shared_timed_mutex>>::value));
+}
+
+
+TEST(ReadLock, ExclusiveForExclusiveMutex)
+{
+  EXPECT_TRUE((std::is_same<ReadLock<std::mutex, std::lock_guard<std::mutex>>, std::lock_guard<std::mutex>>::value));
+  EXPECT_TRUE(
+    (std::is_same<ReadLock<AdaptiveMutex, std::unique_lock<AdaptiveMutex>>, std::unique_lock<AdaptiveMutex>>::value));
+}
+
+#endif  // DOXYGEN_SKIP
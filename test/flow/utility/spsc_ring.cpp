@@ -0,0 +1,158 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/utility/spsc_ring.hpp>
+
+using namespace flow;
+
+
+template <typename RingT> std::vector<int> consume_to_vector(RingT& ring)
+{
+  std::vector<int> values;
+  ring.consume_all([&values](int&& value) { values.push_back(value); });
+  return values;
+}
+
+
+TEST(SPSCRing, DefaultIsEmpty)
+{
+  SPSCRing<int, 4> ring;
+
+  EXPECT_TRUE(ring.empty());
+  EXPECT_EQ(ring.size(), 0UL);
+  EXPECT_EQ(ring.capacity(), 4UL);
+}
+
+
+TEST(SPSCRing, RejectsWhenFull)
+{
+  SPSCRing<int, 4> ring;
+
+  for (int i = 0; i < 4; ++i)
+  {
+    EXPECT_TRUE(ring.try_emplace(i));
+  }
+  EXPECT_FALSE(ring.try_emplace(4));
+  EXPECT_EQ(ring.size(), 4UL);
+
+  EXPECT_EQ(consume_to_vector(ring), (std::vector<int>{0, 1, 2, 3}));
+  EXPECT_TRUE(ring.empty());
+}
+
+
+TEST(SPSCRing, ConsumeWrapsAround)
+{
+  SPSCRing<int, 4> ring;
+
+  std::vector<int> consumed;
+  for (int i = 0; i < 10; ++i)
+  {
+    ASSERT_TRUE(ring.try_emplace(i));
+    if (i % 3 == 2)
+    {
+      const auto values = consume_to_vector(ring);
+      consumed.insert(consumed.end(), values.begin(), values.end());
+    }
+  }
+  const auto values = consume_to_vector(ring);
+  consumed.insert(consumed.end(), values.begin(), values.end());
+
+  EXPECT_EQ(consumed, (std::vector<int>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9}));
+}
+
+
+TEST(SPSCRing, DestroysRemainingElements)
+{
+  const auto value = std::make_shared<int>(1);
+  {
+    SPSCRing<std::shared_ptr<int>, 4> ring;
+    ring.try_emplace(value);
+    ring.try_emplace(value);
+    EXPECT_EQ(value.use_count(), 3L);
+  }
+  EXPECT_EQ(value.use_count(), 1L);
+}
+
+
+TEST(SPSCRing, ConsumeThrowDiscardsOnlyConsumedElement)
+{
+  const auto value = std::make_shared<int>(1);
+  {
+    SPSCRing<std::shared_ptr<int>, 4> ring;
+    for (int i = 0; i < 4; ++i)
+    {
+      ASSERT_TRUE(ring.try_emplace(value));
+    }
+
+    // Second element is discarded by a throwing callback
+    std::size_t consumed = 0;
+    EXPECT_THROW(
+      ring.consume_all([&consumed](std::shared_ptr<int>&&) {
+        if (++consumed == 2UL)
+        {
+          throw std::runtime_error{"consume failed"};
+        }
+      }),
+      std::runtime_error);
+    EXPECT_EQ(ring.size(), 2UL);
+    EXPECT_EQ(value.use_count(), 3L);
+
+    // Remaining elements are consumed once, and their slots are reused
+    EXPECT_EQ(ring.consume_all([](std::shared_ptr<int>&&) {}), 2UL);
+    EXPECT_EQ(value.use_count(), 1L);
+    for (int i = 0; i < 4; ++i)
+    {
+      ASSERT_TRUE(ring.try_emplace(value));
+    }
+    EXPECT_EQ(ring.consume_all([](std::shared_ptr<int>&&) {}), 4UL);
+  }
+  EXPECT_EQ(value.use_count(), 1L);
+}
+
+
+TEST(SPSCRing, ProducerConsumerOrdering)
+{
+  static constexpr int N = 10000;
+
+  SPSCRing<int, 64> ring;
+
+  std::thread producer{[&ring] {
+    for (int i = 0; i < N; ++i)
+    {
+      while (!ring.try_emplace(i))
+      {
+        std::this_thread::yield();
+      }
+    }
+  }};
+
+  int expected = 0;
+  bool ordered = true;
+  while (expected < N)
+  {
+    if (!ring.consume_all([&expected, &ordered](int&& value) { ordered = ordered and (value == expected++); }))
+    {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  EXPECT_TRUE(ordered);
+  EXPECT_TRUE(ring.empty());
+}
+
+#endif  // DOXYGEN_SKIP
@@ -0,0 +1,137 @@
+/**
+ * @copyright 2020-present Fetch Robotics Inc.
+ * @author Brian Cairl
+ */
+#ifndef DOXYGEN_SKIP
+
+// C++ Standard Library
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <limits>
+#include <vector>
+
+// GTest
+#include <gtest/gtest.h>
+
+// Flow
+#include <flow/container/stamp_indexed.hpp>
+#include <flow/dispatch/chrono.hpp>
+#include <flow/dispatch_queue.hpp>
+#include <flow/utility/stamp_search.hpp>
+
+using namespace flow;
+
+
+template <typename KeyT> struct StampSearch : ::testing::Test
+{
+  /// Sorted keys spanning the full range of KeyT, with repeats
+  std::vector<KeyT> keys;
+
+  void SetUp() final
+  {
+    const KeyT lowest = std::numeric_limits<KeyT>::lowest();
+    const KeyT highest = std::numeric_limits<KeyT>::max();
+    for (KeyT k : {lowest, static_cast<KeyT>(lowest + 1), static_cast<KeyT>(highest - 1), highest})
+    {
+      keys.push_back(k);
+    }
+    for (int i = 0; i < 300; ++i)
+    {
+      keys.push_back(static_cast<KeyT>(i / 2 - 50));
+    }
+    std::sort(keys.begin(), keys.end());
+  }
+
+  std::vector<KeyT> queries() const
+  {
+    std::vector<KeyT> q{keys};
+    q.push_back(static_cast<KeyT>(1000));
+    return q;
+  }
+};
+
+using StampSearchKeyTypes = ::testing::Types<std::int32_t, std::uint32_t, std::int64_t, std::uint64_t, double>;
+
+TYPED_TEST_SUITE(StampSearch, StampSearchKeyTypes);
+
+
+TYPED_TEST(StampSearch, LowerBoundMatchesStandard)
+{
+  for (std::size_t n = 0; n <= this->keys.size(); n += 7)
+  {
+    for (const auto key : this->queries())
+    {
+      const auto expected = std::lower_bound(this->keys.data(), this->keys.data() + n, key) - this->keys.data();
+      ASSERT_EQ(stamp_lower_bound(this->keys.data(), n, key), static_cast<std::size_t>(expected)) << "n=" << n;
+    }
+  }
+}
+
+
+TYPED_TEST(StampSearch, UpperBoundMatchesStandard)
+{
+  for (std::size_t n = 0; n <= this->keys.size(); n += 7)
+  {
+    for (const auto key : this->queries())
+    {
+      const auto expected = std::upper_bound(this->keys.data(), this->keys.data() + n, key) - this->keys.data();
+      ASSERT_EQ(stamp_upper_bound(this->keys.data(), n, key), static_cast<std::size_t>(expected)) << "n=" << n;
+    }
+  }
+}
+
+
+TYPED_TEST(StampSearch, UpperBoundFromBackMatchesStandard)
+{
+  for (std::size_t n = 0; n <= this->keys.size(); n += 7)
+  {
+    for (const auto key : this->queries())
+    {
+      const auto expected = std::upper_bound(this->keys.data(), this->keys.data() + n, key) - this->keys.data();
+      ASSERT_EQ(stamp_upper_bound_from_back(this->keys.data(), n, key), static_cast<std::size_t>(expected))
+        << "n=" << n;
+    }
+  }
+}
+
+
+TYPED_TEST(StampSearch, BoundsFromFrontMatchStandard)
+{
+  for (std::size_t n = 0; n <= this->keys.size(); n += 7)
+  {
+    for (const auto key : this->queries())
+    {
+      const auto lower = std::lower_bound(this->keys.data(), this->keys.data() + n, key) - this->keys.data();
+      ASSERT_EQ(stamp_lower_bound_from_front(this->keys.data(), n, key), static_cast<std::size_t>(lower))
+        << "n=" << n;
+
+      const auto upper = std::upper_bound(this->keys.data(), this->keys.data() + n, key) - this->keys.data();
+      ASSERT_EQ(stamp_upper_bound_from_front(this->keys.data(), n, key), static_cast<std::size_t>(upper))
+        << "n=" << n;
+    }
+  }
+}
+
+TEST(StampSearch, ChronoStampIndexedQueue)
+{
+  using ClockType = std::chrono::steady_clock;
+  using StampType = ClockType::time_point;
+  using DispatchType = Dispatch<StampType, int>;
+
+  DispatchQueue<DispatchType, StampIndexed<std::deque<DispatchType>>> queue;
+
+  const auto t0 = ClockType::now();
+  for (int i = 0; i < 200; ++i)
+  {
+    queue.insert(t0 + std::chrono::milliseconds{i}, i);
+  }
+
+  EXPECT_EQ(queue.lower_bound(t0 + std::chrono::milliseconds{100})->value, 100);
+  EXPECT_EQ(queue.upper_bound(t0 + std::chrono::milliseconds{100})->value, 101);
+  EXPECT_EQ(queue.lower_bound(t0 - std::chrono::milliseconds{1}), queue.begin());
+  EXPECT_EQ(queue.upper_bound(t0 + std::chrono::milliseconds{199}), queue.end());
+}
+
+#endif  // DOXYGEN_SKIP